@@ -1,23 +1,23 @@
-/* 
- * File:   ecu_seven_segment_cfg.h
- * Author: yousg
- *
- * Created on February 27, 2025, 12:51 PM
- */
-
-#ifndef ECU_SEVEN_SEGMENT_CFG_H
-#define	ECU_SEVEN_SEGMENT_CFG_H
-
-/******************Section: Includes**********************/
-
-
-/******************Section: Macros Declarations***********/
-                    
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* ECU_SEVEN_SEGMENT_CFG_H */
-
+/* 
+ * File:   ecu_seven_segment_cfg.h
+ * Author: yousg
+ *
+ * Created on February 27, 2025, 12:51 PM
+ */
+
+#ifndef ECU_SEVEN_SEGMENT_CFG_H
+#define	ECU_SEVEN_SEGMENT_CFG_H
+
+/******************Section: Includes**********************/
+
+
+/******************Section: Macros Declarations***********/
+                    
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_SEVEN_SEGMENT_CFG_H */
+
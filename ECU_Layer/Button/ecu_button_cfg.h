@@ -1,22 +1,22 @@
-/* 
- * File:   ecu_button_cfg.h
- * Author: yousg
- *
- * Created on December 7, 2024, 7:34 PM
- */
-
-#ifndef ECU_BUTTON_CFG_H
-#define	ECU_BUTTON_CFG_H
-
-/******************Section: Includes**********************/\
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* ECU_BUTTON_CFG_H */
-
+/* 
+ * File:   ecu_button_cfg.h
+ * Author: yousg
+ *
+ * Created on December 7, 2024, 7:34 PM
+ */
+
+#ifndef ECU_BUTTON_CFG_H
+#define	ECU_BUTTON_CFG_H
+
+/******************Section: Includes**********************/\
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_BUTTON_CFG_H */
+
@@ -1,22 +1,22 @@
-/* 
- * File:   ecu_dc_motor_cfg.h
- * Author: yousg
- *
- * Created on December 10, 2024, 1:11 PM
- */
-
-#ifndef ECU_DC_MOTOR_CFG_H
-#define	ECU_DC_MOTOR_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* ECU_DC_MOTOR_CFG_H */
-
+/* 
+ * File:   ecu_dc_motor_cfg.h
+ * Author: yousg
+ *
+ * Created on December 10, 2024, 1:11 PM
+ */
+
+#ifndef ECU_DC_MOTOR_CFG_H
+#define	ECU_DC_MOTOR_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_DC_MOTOR_CFG_H */
+
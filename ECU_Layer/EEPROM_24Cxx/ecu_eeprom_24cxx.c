@@ -0,0 +1,233 @@
+/*
+ * File:   ecu_eeprom_24cxx.c
+ */
+
+#include "ecu_eeprom_24cxx.h"
+
+typedef struct{
+    uint8 address_bits;      /*Memory size = 2^address_bits bytes*/
+    uint8 page_size;         /*Bytes that one write cycle can program*/
+    uint8 mem_address_size;  /*Word address bytes, upper bits go in the slave address on 1-byte parts*/
+}eeprom_24cxx_geometry_t;
+
+/*Indexed by eeprom_24cxx_device_t*/
+static const eeprom_24cxx_geometry_t eeprom_24cxx_geometry[] = {
+    { 8 ,   8 , I2C_MEM_ADDRESS_8BIT},   /*24C02 : 256 bytes*/
+    { 9 ,  16 , I2C_MEM_ADDRESS_8BIT},   /*24C04 : 512 bytes*/
+    {10 ,  16 , I2C_MEM_ADDRESS_8BIT},   /*24C08 : 1 KB*/
+    {11 ,  16 , I2C_MEM_ADDRESS_8BIT},   /*24C16 : 2 KB*/
+    {12 ,  32 , I2C_MEM_ADDRESS_16BIT},  /*24C32 : 4 KB*/
+    {13 ,  32 , I2C_MEM_ADDRESS_16BIT},  /*24C64 : 8 KB*/
+    {14 ,  64 , I2C_MEM_ADDRESS_16BIT},  /*24C128: 16 KB*/
+    {15 ,  64 , I2C_MEM_ADDRESS_16BIT},  /*24C256: 32 KB*/
+    {16 , 128 , I2C_MEM_ADDRESS_16BIT},  /*24C512: 64 KB*/
+};
+
+static Std_ReturnType eeprom_24cxx_check(const eeprom_24cxx_t *eeprom , uint16 address , uint16 length);
+static uint8 eeprom_24cxx_slave_address(const eeprom_24cxx_t *eeprom , uint16 address);
+static Std_ReturnType eeprom_24cxx_wait_ready(const eeprom_24cxx_t *eeprom);
+
+/**
+ * @brief check the device answers on the bus.
+ * @param eeprom pointer to eeprom_24cxx_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the configuration is invalid or the device doesn't acknowledge.
+ */
+Std_ReturnType eeprom_24cxx_initialize(const eeprom_24cxx_t *eeprom)
+{
+    Std_ReturnType ret = E_OK;
+    ret = eeprom_24cxx_check(eeprom , 0 , 0);
+    if(E_OK == ret)
+    {
+        ret = eeprom_24cxx_wait_ready(eeprom);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+/**
+ * @brief sequential read of any length(split at the 256-byte blocks of the 1-byte address parts).
+ * @param eeprom pointer to eeprom_24cxx_t data.
+ * @param address the first memory address.
+ * @param data buffer for the read bytes.
+ * @param length number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the range is outside the device or the bus transfer failed.
+ */
+Std_ReturnType eeprom_24cxx_read(const eeprom_24cxx_t *eeprom , uint16 address , uint8 *data , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_chunk = 0;
+    if((NULL == data) || (E_NOT_OK == eeprom_24cxx_check(eeprom , address , length)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while((E_OK == ret) && (length > 0))
+        {
+            l_chunk = 0x100U - (address & 0xFFU);
+            if(l_chunk > EEPROM_24CXX_CFG_READ_BURST)
+            {
+                l_chunk = EEPROM_24CXX_CFG_READ_BURST;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(l_chunk > length)
+            {
+                l_chunk = length;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            ret = MSSP_I2C_Master_Mem_Read(eeprom -> i2c , eeprom_24cxx_slave_address(eeprom , address) , address ,
+                                           eeprom_24cxx_geometry[eeprom -> device].mem_address_size ,
+                                           data , (uint8)l_chunk);
+            address += l_chunk;
+            data += l_chunk;
+            length -= l_chunk;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief write of any length split into page-aligned bursts, each burst is followed by
+ *        ACK polling until the write cycle ends(no fixed 5ms delay).
+ * @param eeprom pointer to eeprom_24cxx_t data.
+ * @param address the first memory address.
+ * @param data the bytes to write.
+ * @param length number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the range is outside the device, the bus transfer failed
+ *                     or the device stayed busy for EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS.
+ */
+Std_ReturnType eeprom_24cxx_write(const eeprom_24cxx_t *eeprom , uint16 address , const uint8 *data , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_chunk = 0;
+    uint8 l_page_size = 0;
+    if((NULL == data) || (E_NOT_OK == eeprom_24cxx_check(eeprom , address , length)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_page_size = eeprom_24cxx_geometry[eeprom -> device].page_size;
+        while((E_OK == ret) && (length > 0))
+        {
+            /*A burst must not cross a page, the address counter wraps inside the page*/
+            l_chunk = l_page_size - (address & (l_page_size - 1));
+            if(l_chunk > length)
+            {
+                l_chunk = length;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            ret = MSSP_I2C_Master_Mem_Write(eeprom -> i2c , eeprom_24cxx_slave_address(eeprom , address) , address ,
+                                            eeprom_24cxx_geometry[eeprom -> device].mem_address_size ,
+                                            data , (uint8)l_chunk);
+            if(E_OK == ret)
+            {
+                ret = eeprom_24cxx_wait_ready(eeprom);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            address += l_chunk;
+            data += l_chunk;
+            length -= l_chunk;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief get the memory size of the device.
+ * @param eeprom pointer to eeprom_24cxx_t data.
+ * @param size pointer to store the size in bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType eeprom_24cxx_get_size(const eeprom_24cxx_t *eeprom , uint32 *size)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == size) || (E_NOT_OK == eeprom_24cxx_check(eeprom , 0 , 0)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *size = 1UL << eeprom_24cxx_geometry[eeprom -> device].address_bits;
+    }
+    return ret;
+}
+
+static Std_ReturnType eeprom_24cxx_check(const eeprom_24cxx_t *eeprom , uint16 address , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == eeprom) || (NULL == eeprom -> i2c) || (eeprom -> device > EEPROM_24C512) ||
+       (eeprom -> address_pins > 0x07U))
+    {
+        ret = E_NOT_OK;
+    }
+    else if(((uint32)address + length) > (1UL << eeprom_24cxx_geometry[eeprom -> device].address_bits))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+static uint8 eeprom_24cxx_slave_address(const eeprom_24cxx_t *eeprom , uint16 address)
+{
+    uint8 l_slave_address = EEPROM_24CXX_BASE_ADDRESS | eeprom -> address_pins;
+    if(I2C_MEM_ADDRESS_8BIT == eeprom_24cxx_geometry[eeprom -> device].mem_address_size)
+    {
+        /*24C04/08/16: address bits 8..10 select the 256-byte block*/
+        l_slave_address |= (uint8)(address >> 8);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return l_slave_address;
+}
+
+/*ACK polling: the device ignores its address until the internal write cycle ends*/
+static Std_ReturnType eeprom_24cxx_wait_ready(const eeprom_24cxx_t *eeprom)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint16 l_polls = 0;
+    while((E_NOT_OK == ret) && (l_polls < EEPROM_24CXX_ACK_POLL_LIMIT))
+    {
+        ret = MSSP_I2C_Master_Mem_Write(eeprom -> i2c , EEPROM_24CXX_BASE_ADDRESS | eeprom -> address_pins , 0 ,
+                                        I2C_MEM_ADDRESS_NONE , NULL , 0);
+        if(E_NOT_OK == ret)
+        {
+            __delay_us(EEPROM_24CXX_ACK_POLL_INTERVAL_US);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        l_polls++;
+    }
+    return ret;
+}
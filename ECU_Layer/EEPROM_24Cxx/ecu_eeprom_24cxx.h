@@ -0,0 +1,50 @@
+/*
+ * File:   ecu_eeprom_24cxx.h
+ */
+
+#ifndef ECU_EEPROM_24CXX_H
+#define	ECU_EEPROM_24CXX_H
+
+/******************Section: Includes**********************/
+#include "ecu_eeprom_24cxx_cfg.h"
+#include "../../MCAL_Layer/I2C/hal_i2c.h"
+
+/******************Section: Macros Declarations***********/
+#define EEPROM_24CXX_BASE_ADDRESS           0x50U
+
+/*A busy poll is followed by this delay, so the polls cover the timeout at any I2C clock*/
+#define EEPROM_24CXX_ACK_POLL_INTERVAL_US   100UL
+#define EEPROM_24CXX_ACK_POLL_LIMIT         ((EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS * 1000UL) / EEPROM_24CXX_ACK_POLL_INTERVAL_US)
+
+#if (EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS < 5UL) || (EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS > 1000UL)
+#error "EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS must be 5 - 1000, tWR is up to 5ms"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    EEPROM_24C02 = 0,
+    EEPROM_24C04,
+    EEPROM_24C08,
+    EEPROM_24C16,
+    EEPROM_24C32,
+    EEPROM_24C64,
+    EEPROM_24C128,
+    EEPROM_24C256,
+    EEPROM_24C512
+}eeprom_24cxx_device_t;
+
+typedef struct{
+    const mssp_i2c_t *i2c;            /*Initialized MSSP in master mode*/
+    eeprom_24cxx_device_t device;
+    uint8 address_pins;               /*A2..A0 strapping, on 24C04/08/16 the block select bits must be 0*/
+}eeprom_24cxx_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType eeprom_24cxx_initialize(const eeprom_24cxx_t *eeprom);
+Std_ReturnType eeprom_24cxx_read(const eeprom_24cxx_t *eeprom , uint16 address , uint8 *data , uint16 length);
+Std_ReturnType eeprom_24cxx_write(const eeprom_24cxx_t *eeprom , uint16 address , const uint8 *data , uint16 length);
+Std_ReturnType eeprom_24cxx_get_size(const eeprom_24cxx_t *eeprom , uint32 *size);
+
+#endif	/* ECU_EEPROM_24CXX_H */
@@ -0,0 +1,22 @@
+/*
+ * File:   ecu_eeprom_24cxx_cfg.h
+ */
+
+#ifndef ECU_EEPROM_24CXX_CFG_H
+#define	ECU_EEPROM_24CXX_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Longest wait for the internal write cycle after a page write(tWR is 5ms max)*/
+#define EEPROM_24CXX_CFG_WRITE_TIMEOUT_MS   10UL
+/*Largest sequential read done in one I2C transaction*/
+#define EEPROM_24CXX_CFG_READ_BURST         128U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_EEPROM_24CXX_CFG_H */
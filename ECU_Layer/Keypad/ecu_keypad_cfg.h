@@ -1,22 +1,22 @@
-/* 
- * File:   ecu_keypad_cfg.h
- * Author: yousg
- *
- * Created on February 27, 2025, 4:08 PM
- */
-
-#ifndef ECU_KEYPAD_CFG_H
-#define	ECU_KEYPAD_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* ECU_KEYPAD_CFG_H */
-
+/* 
+ * File:   ecu_keypad_cfg.h
+ * Author: yousg
+ *
+ * Created on February 27, 2025, 4:08 PM
+ */
+
+#ifndef ECU_KEYPAD_CFG_H
+#define	ECU_KEYPAD_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_KEYPAD_CFG_H */
+
@@ -1,14 +1,14 @@
-/* 
- * File:   ecu_chr_LCD_cfg.h
- * Author: yousg
- *
- * Created on March 4, 2025, 2:37 PM
- */
-
-#ifndef ECU_CHR_LCD_CFG_H
-#define	ECU_CHR_LCD_CFG_H
-
-
-
-#endif	/* ECU_CHR_LCD_CFG_H */
-
+/* 
+ * File:   ecu_chr_LCD_cfg.h
+ * Author: yousg
+ *
+ * Created on March 4, 2025, 2:37 PM
+ */
+
+#ifndef ECU_CHR_LCD_CFG_H
+#define	ECU_CHR_LCD_CFG_H
+
+
+
+#endif	/* ECU_CHR_LCD_CFG_H */
+
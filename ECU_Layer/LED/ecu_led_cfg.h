@@ -1,21 +1,21 @@
-/* 
- * File:   ecu_led_cfg.h
- * Author: Ibrahim Shenouda
- *
- * Created on 07 ??????, 2024, 03:22 ?
- */
-
-#ifndef ECU_LED_CFG_H
-#define	ECU_LED_CFG_H
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* ECU_LED_CFG_H */
-
+/* 
+ * File:   ecu_led_cfg.h
+ * Author: Ibrahim Shenouda
+ *
+ * Created on 07 ??????, 2024, 03:22 ?
+ */
+
+#ifndef ECU_LED_CFG_H
+#define	ECU_LED_CFG_H
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_LED_CFG_H */
+
@@ -0,0 +1,665 @@
+/*
+ * File:   ecu_modbus_rtu.c
+ */
+
+#include "ecu_modbus_rtu.h"
+
+/*
+ * Receive : modbus_rtu_receive_byte runs from the EUSART RX ISR(EUSART_RxByteHandler),
+ *           stores the byte, updates the CRC and restarts TIMER3.
+ * Gap     : TIMER3 overflows after 3.5 character times of silence and closes the frame.
+ *           a frame for another slave is dropped there and reception goes on.
+ * Process : modbus_rtu_process(main loop) executes the request in place.
+ * Respond : the response is sent by the EUSART TX ISR(EUSART_ASYNCH_WriteBufferNonBlocking).
+ */
+
+#define MODBUS_RTU_STATE_RECEIVING       0x00U
+#define MODBUS_RTU_STATE_FRAME_READY     0x01U
+#define MODBUS_RTU_STATE_TRANSMITTING    0x02U
+
+#define MODBUS_RTU_COIL_ON               0xFF00U
+#define MODBUS_RTU_COIL_OFF              0x0000U
+
+/*Above 19200 baud the standard fixes t3.5 to 1750us*/
+#define MODBUS_RTU_FIXED_GAP_BAUDRATE    19200UL
+#define MODBUS_RTU_FIXED_GAP_US          1750UL
+
+static const uint16 modbus_rtu_crc_table[16] = {
+    0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+    0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400
+};
+
+static const modbus_rtu_t *modbus_rtu_obj = NULL;
+static timer3_t modbus_rtu_timer;
+
+static uint8 modbus_rtu_buffer[MODBUS_RTU_CFG_BUFFER_SIZE];
+static volatile uint16 modbus_rtu_length = 0;
+static volatile uint16 modbus_rtu_crc = MODBUS_RTU_CRC_INIT;
+static volatile uint8 modbus_rtu_overrun = 0;
+static volatile uint8 modbus_rtu_state = MODBUS_RTU_STATE_RECEIVING;
+static volatile modbus_rtu_statistics_t modbus_rtu_statistics = {0};
+
+static void modbus_rtu_frame_timeout(void);
+static uint16 modbus_rtu_crc16_update(uint16 crc , uint8 data);
+static uint16 modbus_rtu_execute(uint16 length);
+static uint16 modbus_rtu_read_coils(uint16 length);
+static uint16 modbus_rtu_read_registers(uint16 length);
+static uint16 modbus_rtu_write_single_coil(uint16 length);
+static uint16 modbus_rtu_write_single_register(uint16 length);
+static uint16 modbus_rtu_write_multiple_registers(uint16 length);
+static uint16 modbus_rtu_exception(uint8 exception_code);
+static const modbus_rtu_register_region_t *modbus_rtu_find_register_region(
+        const modbus_rtu_register_region_t *regions , uint8 region_count , uint16 address , uint16 quantity);
+static const modbus_rtu_coil_region_t *modbus_rtu_find_coil_region(
+        const modbus_rtu_coil_region_t *regions , uint8 region_count , uint16 address , uint16 quantity);
+static uint16 modbus_rtu_get_u16(uint16 index);
+static void modbus_rtu_put_u16(uint16 index , uint16 value);
+static void modbus_rtu_notify(uint8 function_code , uint16 address , uint16 quantity);
+static void modbus_rtu_rx_reset(void);
+
+/**
+ * @brief initialize the slave and TIMER3 for the 3.5 character gap.
+ *        the EUSART must be initialized first with the RX interrupt enabled,
+ *        modbus_rtu_receive_byte as EUSART_RxByteHandler and the TX interrupt enabled.
+ * @param modbus pointer points to modbus_rtu_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType modbus_rtu_initialize(const modbus_rtu_t *modbus)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_baudrate = 0;
+    uint32 l_ticks = 0;
+    uint8 l_prescaler = TIMER3_PRESCALER_DIV_BY_1;
+    if((NULL == modbus) || (NULL == modbus -> register_map) ||
+       (MODBUS_RTU_BROADCAST_ADDRESS == modbus -> slave_address))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = EUSART_ASYNCH_GetBaudrate(&l_baudrate);
+        if((E_NOT_OK == ret) || (0 == l_baudrate))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*TIMER3 runs at Fosc/4, t3.5 = 3.5 characters of 11 bits = 38.5 bit times*/
+            if(l_baudrate > MODBUS_RTU_FIXED_GAP_BAUDRATE)
+            {
+                l_ticks = ((_XTAL_FREQ / 4UL) / 1000UL) * MODBUS_RTU_FIXED_GAP_US / 1000UL;
+            }
+            else
+            {
+                l_ticks = ((_XTAL_FREQ / 4UL) * 77UL) / (2UL * l_baudrate);
+            }
+            while((l_ticks > 0xFFFFUL) && (l_prescaler < TIMER3_PRESCALER_DIV_BY_8))
+            {
+                l_ticks >>= 1;
+                l_prescaler++;
+            }
+            if(l_ticks > 0xFFFFUL)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                modbus_rtu_obj = NULL;
+                modbus_rtu_timer.TIMER3_InterruptHandler = modbus_rtu_frame_timeout;
+                modbus_rtu_timer.priority = MODBUS_RTU_CFG_TIMER_PRIORITY;
+                modbus_rtu_timer.prescaler_value = l_prescaler;
+                modbus_rtu_timer.timer3_mode = TIMER3_TIMER_MODE;
+                modbus_rtu_timer.timer3_counter_mode = TIMER3_SYNC_COUNTER_MODE;
+                modbus_rtu_timer.timer3_reg_wr_mode = TIMER3_RW_REGESTER_16BIT_MODE;
+                modbus_rtu_timer.timer3_preload_value = (uint16)(0x10000UL - l_ticks);
+                ret = Timer3_Init(&modbus_rtu_timer);
+                if(E_OK == ret)
+                {
+                    ret = Timer3_Stop(&modbus_rtu_timer);
+                    modbus_rtu_rx_reset();
+                    modbus_rtu_state = MODBUS_RTU_STATE_RECEIVING;
+                    modbus_rtu_obj = modbus;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief store one received byte and restart the inter-frame gap timer.
+ *        meant to be the EUSART_RxByteHandler(runs in the RX ISR).
+ * @param data the received byte.
+ */
+void modbus_rtu_receive_byte(uint8 data)
+{
+    if(NULL == modbus_rtu_obj)
+    {
+        /*NOTHING*/
+    }
+    else if(MODBUS_RTU_STATE_RECEIVING != modbus_rtu_state)
+    {
+        /*Half duplex: the master must wait for the response*/
+        modbus_rtu_statistics.busy_drops++;
+    }
+    else
+    {
+        if(modbus_rtu_length < MODBUS_RTU_CFG_BUFFER_SIZE)
+        {
+            modbus_rtu_buffer[modbus_rtu_length] = data;
+            modbus_rtu_length++;
+            modbus_rtu_crc = modbus_rtu_crc16_update(modbus_rtu_crc , data);
+        }
+        else
+        {
+            modbus_rtu_overrun = 1;
+        }
+        Timer3_Stop(&modbus_rtu_timer);
+        Timer3_Write_Value(&modbus_rtu_timer , modbus_rtu_timer.timer3_preload_value);
+        Timer3_Start(&modbus_rtu_timer);
+    }
+}
+
+/**
+ * @brief execute a complete request and queue the response, never waits.
+ *        must be called periodically from the main loop.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the slave is not initialized.
+ */
+Std_ReturnType modbus_rtu_process(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_response_length = 0;
+    uint16 l_pending = 0;
+    uint16 l_crc = 0;
+    if(NULL == modbus_rtu_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(MODBUS_RTU_STATE_FRAME_READY == modbus_rtu_state)
+    {
+        /*Only frames for this slave or broadcasts are kept by the gap ISR*/
+        l_response_length = modbus_rtu_execute(modbus_rtu_length - 2);
+        if(MODBUS_RTU_BROADCAST_ADDRESS == modbus_rtu_buffer[0])
+        {
+            l_response_length = 0;/*Broadcast requests are never answered*/
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(0 != l_response_length)
+        {
+            ret = modbus_rtu_crc16(modbus_rtu_buffer , l_response_length , &l_crc);
+            modbus_rtu_buffer[l_response_length] = (uint8)l_crc;
+            modbus_rtu_buffer[l_response_length + 1] = (uint8)(l_crc >> 8);
+            modbus_rtu_state = MODBUS_RTU_STATE_TRANSMITTING;
+            ret = EUSART_ASYNCH_WriteBufferNonBlocking(modbus_rtu_buffer , l_response_length + 2);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(MODBUS_RTU_STATE_TRANSMITTING != modbus_rtu_state)
+        {
+            modbus_rtu_rx_reset();
+            modbus_rtu_state = MODBUS_RTU_STATE_RECEIVING;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else if(MODBUS_RTU_STATE_TRANSMITTING == modbus_rtu_state)
+    {
+        ret = EUSART_ASYNCH_TX_Pending(&l_pending);
+        if(0 == l_pending)
+        {
+            modbus_rtu_rx_reset();
+            modbus_rtu_state = MODBUS_RTU_STATE_RECEIVING;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+/**
+ * @brief take a consistent snapshot of the slave counters.
+ * @param statistics pointer to store the counters.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType modbus_rtu_get_statistics(modbus_rtu_statistics_t *statistics)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Part of the counters are written by the ISRs, copy until two reads agree*/
+        do
+        {
+            statistics -> frames_received = modbus_rtu_statistics.frames_received;
+            statistics -> crc_errors = modbus_rtu_statistics.crc_errors;
+            statistics -> overruns = modbus_rtu_statistics.overruns;
+            statistics -> busy_drops = modbus_rtu_statistics.busy_drops;
+            statistics -> exceptions = modbus_rtu_statistics.exceptions;
+        }while((statistics -> crc_errors != modbus_rtu_statistics.crc_errors) ||
+               (statistics -> overruns != modbus_rtu_statistics.overruns) ||
+               (statistics -> busy_drops != modbus_rtu_statistics.busy_drops));
+    }
+    return ret;
+}
+
+/**
+ * @brief calculate the CRC-16/MODBUS of a buffer, sent low byte first.
+ * @param data the bytes to check.
+ * @param length number of bytes.
+ * @param crc pointer to store the CRC.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType modbus_rtu_crc16(const uint8 *data , uint16 length , uint16 *crc)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = MODBUS_RTU_CRC_INIT;
+    uint16 l_counter = 0;
+    if((NULL == data) || (NULL == crc))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_counter = 0 ; l_counter < length ; l_counter++)
+        {
+            l_crc = modbus_rtu_crc16_update(l_crc , data[l_counter]);
+        }
+        *crc = l_crc;
+    }
+    return ret;
+}
+
+/**
+ * @brief TIMER3 overflow: the line was idle for 3.5 characters, close the frame.
+ *        the CRC was accumulated over every byte, so a valid frame leaves 0.
+ *        frames for other slaves are dropped here, reception goes on at once.
+ */
+static void modbus_rtu_frame_timeout(void)
+{
+    Timer3_Stop(&modbus_rtu_timer);
+    if((NULL == modbus_rtu_obj) || (MODBUS_RTU_STATE_RECEIVING != modbus_rtu_state))
+    {
+        /*NOTHING*/
+    }
+    else if(modbus_rtu_overrun)
+    {
+        modbus_rtu_statistics.overruns++;
+        modbus_rtu_rx_reset();
+    }
+    else if((modbus_rtu_length < MODBUS_RTU_MIN_FRAME_SIZE) || (0 != modbus_rtu_crc))
+    {
+        modbus_rtu_statistics.crc_errors++;
+        modbus_rtu_rx_reset();
+    }
+    else if((modbus_rtu_obj -> slave_address != modbus_rtu_buffer[0]) &&
+            (MODBUS_RTU_BROADCAST_ADDRESS != modbus_rtu_buffer[0]))
+    {
+        modbus_rtu_rx_reset();
+    }
+    else
+    {
+        modbus_rtu_statistics.frames_received++;
+        modbus_rtu_state = MODBUS_RTU_STATE_FRAME_READY;
+    }
+}
+
+static uint16 modbus_rtu_crc16_update(uint16 crc , uint8 data)
+{
+    crc = (crc >> 4) ^ modbus_rtu_crc_table[(uint8)(crc ^ data) & 0x0F];
+    crc = (crc >> 4) ^ modbus_rtu_crc_table[(uint8)(crc ^ (data >> 4)) & 0x0F];
+    return crc;
+}
+
+/**
+ * @brief execute the request held in the buffer and build the response in place.
+ * @param length request length without the CRC.
+ * @return the response length without the CRC.
+ */
+static uint16 modbus_rtu_execute(uint16 length)
+{
+    uint16 l_response_length = 0;
+    switch(modbus_rtu_buffer[1])
+    {
+        case MODBUS_RTU_FC_READ_COILS:
+            l_response_length = modbus_rtu_read_coils(length);
+            break;
+        case MODBUS_RTU_FC_READ_HOLDING_REGISTERS:
+        case MODBUS_RTU_FC_READ_INPUT_REGISTERS:
+            l_response_length = modbus_rtu_read_registers(length);
+            break;
+        case MODBUS_RTU_FC_WRITE_SINGLE_COIL:
+            l_response_length = modbus_rtu_write_single_coil(length);
+            break;
+        case MODBUS_RTU_FC_WRITE_SINGLE_REGISTER:
+            l_response_length = modbus_rtu_write_single_register(length);
+            break;
+        case MODBUS_RTU_FC_WRITE_MULTIPLE_REGISTERS:
+            l_response_length = modbus_rtu_write_multiple_registers(length);
+            break;
+        default:
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_FUNCTION);
+            break;
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_read_coils(uint16 length)
+{
+    uint16 l_response_length = 0;
+    uint16 l_address = modbus_rtu_get_u16(2);
+    uint16 l_quantity = modbus_rtu_get_u16(4);
+    uint16 l_byte_count = (l_quantity + 7) >> 3;
+    uint16 l_counter = 0;
+    uint16 l_bit = 0;
+    const modbus_rtu_coil_region_t *l_region = NULL;
+    if((6 != length) || (0 == l_quantity) || (l_quantity > MODBUS_RTU_MAX_READ_COILS) ||
+       ((3U + l_byte_count + 2U) > MODBUS_RTU_CFG_BUFFER_SIZE))
+    {
+        l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+    }
+    else
+    {
+        l_region = modbus_rtu_find_coil_region(modbus_rtu_obj -> register_map -> coils ,
+                                               modbus_rtu_obj -> register_map -> coil_regions ,
+                                               l_address , l_quantity);
+        if(NULL == l_region)
+        {
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        else
+        {
+            modbus_rtu_buffer[2] = (uint8)l_byte_count;
+            for(l_counter = 0 ; l_counter < l_byte_count ; l_counter++)
+            {
+                modbus_rtu_buffer[3 + l_counter] = 0;
+            }
+            l_bit = l_address - l_region -> start_address;
+            for(l_counter = 0 ; l_counter < l_quantity ; l_counter++)
+            {
+                if((l_region -> data[l_bit >> 3] >> (l_bit & 0x07)) & 0x01)
+                {
+                    modbus_rtu_buffer[3 + (l_counter >> 3)] |= (uint8)(1 << (l_counter & 0x07));
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                l_bit++;
+            }
+            l_response_length = 3 + l_byte_count;
+        }
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_read_registers(uint16 length)
+{
+    uint16 l_response_length = 0;
+    uint16 l_address = modbus_rtu_get_u16(2);
+    uint16 l_quantity = modbus_rtu_get_u16(4);
+    uint16 l_counter = 0;
+    const modbus_rtu_register_region_t *l_region = NULL;
+    if((6 != length) || (0 == l_quantity) || (l_quantity > MODBUS_RTU_MAX_READ_REGISTERS) ||
+       ((3U + (2U * l_quantity) + 2U) > MODBUS_RTU_CFG_BUFFER_SIZE))
+    {
+        l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+    }
+    else
+    {
+        if(MODBUS_RTU_FC_READ_HOLDING_REGISTERS == modbus_rtu_buffer[1])
+        {
+            l_region = modbus_rtu_find_register_region(modbus_rtu_obj -> register_map -> holding_registers ,
+                                                       modbus_rtu_obj -> register_map -> holding_register_regions ,
+                                                       l_address , l_quantity);
+        }
+        else
+        {
+            l_region = modbus_rtu_find_register_region(modbus_rtu_obj -> register_map -> input_registers ,
+                                                       modbus_rtu_obj -> register_map -> input_register_regions ,
+                                                       l_address , l_quantity);
+        }
+        if(NULL == l_region)
+        {
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        else
+        {
+            modbus_rtu_buffer[2] = (uint8)(2 * l_quantity);
+            l_address -= l_region -> start_address;
+            for(l_counter = 0 ; l_counter < l_quantity ; l_counter++)
+            {
+                modbus_rtu_put_u16(3 + (2 * l_counter) , l_region -> data[l_address + l_counter]);
+            }
+            l_response_length = 3 + (2 * l_quantity);
+        }
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_write_single_coil(uint16 length)
+{
+    uint16 l_response_length = 0;
+    uint16 l_address = modbus_rtu_get_u16(2);
+    uint16 l_value = modbus_rtu_get_u16(4);
+    uint16 l_bit = 0;
+    const modbus_rtu_coil_region_t *l_region = NULL;
+    if((6 != length) || ((MODBUS_RTU_COIL_ON != l_value) && (MODBUS_RTU_COIL_OFF != l_value)))
+    {
+        l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+    }
+    else
+    {
+        l_region = modbus_rtu_find_coil_region(modbus_rtu_obj -> register_map -> coils ,
+                                               modbus_rtu_obj -> register_map -> coil_regions ,
+                                               l_address , 1);
+        if(NULL == l_region)
+        {
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        else
+        {
+            l_bit = l_address - l_region -> start_address;
+            if(MODBUS_RTU_COIL_ON == l_value)
+            {
+                l_region -> data[l_bit >> 3] |= (uint8)(1 << (l_bit & 0x07));
+            }
+            else
+            {
+                l_region -> data[l_bit >> 3] &= (uint8)~(1 << (l_bit & 0x07));
+            }
+            modbus_rtu_notify(MODBUS_RTU_FC_WRITE_SINGLE_COIL , l_address , 1);
+            l_response_length = 6;/*Echo of the request*/
+        }
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_write_single_register(uint16 length)
+{
+    uint16 l_response_length = 0;
+    uint16 l_address = modbus_rtu_get_u16(2);
+    const modbus_rtu_register_region_t *l_region = NULL;
+    if(6 != length)
+    {
+        l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+    }
+    else
+    {
+        l_region = modbus_rtu_find_register_region(modbus_rtu_obj -> register_map -> holding_registers ,
+                                                   modbus_rtu_obj -> register_map -> holding_register_regions ,
+                                                   l_address , 1);
+        if(NULL == l_region)
+        {
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        else
+        {
+            l_region -> data[l_address - l_region -> start_address] = modbus_rtu_get_u16(4);
+            modbus_rtu_notify(MODBUS_RTU_FC_WRITE_SINGLE_REGISTER , l_address , 1);
+            l_response_length = 6;/*Echo of the request*/
+        }
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_write_multiple_registers(uint16 length)
+{
+    uint16 l_response_length = 0;
+    uint16 l_address = modbus_rtu_get_u16(2);
+    uint16 l_quantity = modbus_rtu_get_u16(4);
+    uint16 l_counter = 0;
+    const modbus_rtu_register_region_t *l_region = NULL;
+    if((length < 7) || (0 == l_quantity) || (l_quantity > MODBUS_RTU_MAX_WRITE_REGISTERS) ||
+       (modbus_rtu_buffer[6] != (2 * l_quantity)) || (length != (7 + (2 * l_quantity))))
+    {
+        l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE);
+    }
+    else
+    {
+        l_region = modbus_rtu_find_register_region(modbus_rtu_obj -> register_map -> holding_registers ,
+                                                   modbus_rtu_obj -> register_map -> holding_register_regions ,
+                                                   l_address , l_quantity);
+        if(NULL == l_region)
+        {
+            l_response_length = modbus_rtu_exception(MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS);
+        }
+        else
+        {
+            for(l_counter = 0 ; l_counter < l_quantity ; l_counter++)
+            {
+                l_region -> data[(l_address - l_region -> start_address) + l_counter] =
+                        modbus_rtu_get_u16(7 + (2 * l_counter));
+            }
+            modbus_rtu_notify(MODBUS_RTU_FC_WRITE_MULTIPLE_REGISTERS , l_address , l_quantity);
+            l_response_length = 6;/*Address, function, start address and quantity are already in place*/
+        }
+    }
+    return l_response_length;
+}
+
+static uint16 modbus_rtu_exception(uint8 exception_code)
+{
+    modbus_rtu_buffer[1] |= 0x80;
+    modbus_rtu_buffer[2] = exception_code;
+    if(MODBUS_RTU_BROADCAST_ADDRESS != modbus_rtu_buffer[0])
+    {
+        modbus_rtu_statistics.exceptions++;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return 3;
+}
+
+static const modbus_rtu_register_region_t *modbus_rtu_find_register_region(
+        const modbus_rtu_register_region_t *regions , uint8 region_count , uint16 address , uint16 quantity)
+{
+    const modbus_rtu_register_region_t *l_region = NULL;
+    uint8 l_counter = 0;
+    if(NULL != regions)
+    {
+        for(l_counter = 0 ; (l_counter < region_count) && (NULL == l_region) ; l_counter++)
+        {
+            if((address >= regions[l_counter].start_address) &&
+               ((uint32)(address - regions[l_counter].start_address) + quantity <= regions[l_counter].quantity))
+            {
+                l_region = &regions[l_counter];
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return l_region;
+}
+
+static const modbus_rtu_coil_region_t *modbus_rtu_find_coil_region(
+        const modbus_rtu_coil_region_t *regions , uint8 region_count , uint16 address , uint16 quantity)
+{
+    const modbus_rtu_coil_region_t *l_region = NULL;
+    uint8 l_counter = 0;
+    if(NULL != regions)
+    {
+        for(l_counter = 0 ; (l_counter < region_count) && (NULL == l_region) ; l_counter++)
+        {
+            if((address >= regions[l_counter].start_address) &&
+               ((uint32)(address - regions[l_counter].start_address) + quantity <= regions[l_counter].quantity))
+            {
+                l_region = &regions[l_counter];
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return l_region;
+}
+
+static uint16 modbus_rtu_get_u16(uint16 index)
+{
+    return (uint16)(((uint16)modbus_rtu_buffer[index] << 8) | modbus_rtu_buffer[index + 1]);
+}
+
+static void modbus_rtu_put_u16(uint16 index , uint16 value)
+{
+    modbus_rtu_buffer[index] = (uint8)(value >> 8);
+    modbus_rtu_buffer[index + 1] = (uint8)value;
+}
+
+static void modbus_rtu_notify(uint8 function_code , uint16 address , uint16 quantity)
+{
+    if(NULL != modbus_rtu_obj -> register_map -> write_notification)
+    {
+        modbus_rtu_obj -> register_map -> write_notification(function_code , address , quantity);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void modbus_rtu_rx_reset(void)
+{
+    modbus_rtu_length = 0;
+    modbus_rtu_crc = MODBUS_RTU_CRC_INIT;
+    modbus_rtu_overrun = 0;
+}
@@ -0,0 +1,97 @@
+/* 
+ * File:   ecu_modbus_rtu.h
+ */
+
+#ifndef ECU_MODBUS_RTU_H
+#define	ECU_MODBUS_RTU_H
+
+/******************Section: Includes**********************/
+#include "ecu_modbus_rtu_cfg.h"
+#include "../../MCAL_Layer/USART/hal_usart.h"
+#include "../../MCAL_Layer/Timer3/hal_timer3.h"
+
+/******************Section: Macros Declarations***********/
+#define MODBUS_RTU_BROADCAST_ADDRESS             0x00U
+
+#define MODBUS_RTU_FC_READ_COILS                 0x01U
+#define MODBUS_RTU_FC_READ_HOLDING_REGISTERS     0x03U
+#define MODBUS_RTU_FC_READ_INPUT_REGISTERS       0x04U
+#define MODBUS_RTU_FC_WRITE_SINGLE_COIL          0x05U
+#define MODBUS_RTU_FC_WRITE_SINGLE_REGISTER      0x06U
+#define MODBUS_RTU_FC_WRITE_MULTIPLE_REGISTERS   0x10U
+
+#define MODBUS_RTU_EXCEPTION_ILLEGAL_FUNCTION    0x01U
+#define MODBUS_RTU_EXCEPTION_ILLEGAL_ADDRESS     0x02U
+#define MODBUS_RTU_EXCEPTION_ILLEGAL_VALUE       0x03U
+
+#define MODBUS_RTU_MAX_READ_COILS                2000U
+#define MODBUS_RTU_MAX_READ_REGISTERS            125U
+#define MODBUS_RTU_MAX_WRITE_REGISTERS           123U
+
+#define MODBUS_RTU_CRC_INIT                      0xFFFFU   /*CRC-16/MODBUS, reflected polynomial 0xA001*/
+#define MODBUS_RTU_MIN_FRAME_SIZE                4U        /*Address + function + CRC*/
+
+#if (TIMER3_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE) || \
+    (EUSART_TX_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "Modbus RTU needs the TIMER3 and EUSART TX interrupt features"
+#endif
+
+/*The PWM ramp can't step from Timer3 as well, caught where both modules are included*/
+#if defined(ECU_PWM_RAMP_H) && (PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER3)
+#error "Timer3 is owned by Modbus RTU, select PWM_RAMP_STEP_TIMER1 for the ramp"
+#endif
+
+#if MODBUS_RTU_CFG_BUFFER_SIZE < 8U
+#error "MODBUS_RTU_CFG_BUFFER_SIZE is too small for a Modbus RTU request"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+/*A block of consecutive 16-bit registers starting at start_address*/
+typedef struct{
+    uint16 start_address;
+    uint16 quantity;
+    uint16 *data;
+}modbus_rtu_register_region_t;
+
+/*A block of consecutive coils, bit packed: coil start_address is bit 0 of data[0]*/
+typedef struct{
+    uint16 start_address;
+    uint16 quantity;
+    uint8 *data;
+}modbus_rtu_coil_region_t;
+
+/*Const description of the data served to the master, a request must fit one region*/
+typedef struct{
+    const modbus_rtu_register_region_t *holding_registers;
+    const modbus_rtu_register_region_t *input_registers;
+    const modbus_rtu_coil_region_t *coils;
+    uint8 holding_register_regions;
+    uint8 input_register_regions;
+    uint8 coil_regions;
+    /*Optional, called from modbus_rtu_process after the master wrote quantity items from address*/
+    void (*write_notification)(uint8 function_code , uint16 address , uint16 quantity);
+}modbus_rtu_register_map_t;
+
+typedef struct{
+    uint8 slave_address;                            /*1..247*/
+    const modbus_rtu_register_map_t *register_map;
+}modbus_rtu_t;
+
+typedef struct{
+    uint16 frames_received;   /*Valid requests addressed to this slave(or broadcast)*/
+    uint16 crc_errors;        /*Frames dropped because of a CRC mismatch or a runt frame*/
+    uint16 overruns;          /*Frames dropped because they did not fit the buffer*/
+    uint16 busy_drops;        /*Bytes dropped while a request was processed or answered*/
+    uint16 exceptions;        /*Exception responses sent*/
+}modbus_rtu_statistics_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType modbus_rtu_initialize(const modbus_rtu_t *modbus);
+void modbus_rtu_receive_byte(uint8 data);
+Std_ReturnType modbus_rtu_process(void);
+Std_ReturnType modbus_rtu_get_statistics(modbus_rtu_statistics_t *statistics);
+Std_ReturnType modbus_rtu_crc16(const uint8 *data , uint16 length , uint16 *crc);
+
+#endif	/* ECU_MODBUS_RTU_H */
@@ -0,0 +1,23 @@
+/* 
+ * File:   ecu_modbus_rtu_cfg.h
+ */
+
+#ifndef ECU_MODBUS_RTU_CFG_H
+#define	ECU_MODBUS_RTU_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Request/response buffer(RTU ADU max is 256 bytes, smaller buffers limit the quantity per request)*/
+#define MODBUS_RTU_CFG_BUFFER_SIZE       256U
+
+/*Priority of the TIMER3 inter-frame gap interrupt, keep it equal to the EUSART RX priority*/
+#define MODBUS_RTU_CFG_TIMER_PRIORITY    INTERRUPT_LOW_PRIORITY
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_MODBUS_RTU_CFG_H */
@@ -0,0 +1,425 @@
+/*
+ * File:   ecu_pwm_ramp.c
+ */
+
+#include "ecu_pwm_ramp.h"
+
+/*
+ * Units   : duty in Q16(CCP_PWM_DUTY_Q16_FULL = 100%), velocity in Q16 duty per step,
+ *           accel in Q16 duty per step per step.
+ * Profile : every step picks velocity + accel, velocity or velocity - accel, the
+ *           fastest one that can still stop at the target(brake_distance <= remaining).
+ *           Linear is the same engine with accel = max_velocity(no blend at the ends),
+ *           the S-curve blends the slew rate in and out over accel_ms.
+ * Retarget: a new target keeps the running velocity, a target behind the motion
+ *           decelerates to zero first and then reverses.
+ * ISR cost: the profile itself only adds and compares, the duty write goes through
+ *           CCP_PWM_SetDutyQ16(one 32-bit multiply per running channel and step).
+ */
+
+#define PWM_RAMP_DIRECTION_UP        0x00U
+#define PWM_RAMP_DIRECTION_DOWN      0x01U
+
+/*Step timer interrupt enable, saved and cleared around the channel state updates*/
+#if PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER1
+#define PWM_RAMP_STEP_IE                      (PIE1bits.TMR1IE)
+#define PWM_RAMP_STEP_InterruptDisable()      TIMER1_InterruptDisable()
+#else
+#define PWM_RAMP_STEP_IE                      (PIE2bits.TMR3IE)
+#define PWM_RAMP_STEP_InterruptDisable()      TIMER3_InterruptDisable()
+#endif
+
+typedef struct{
+    const ccp_t *pwm;
+    void(*ramp_done_callback)(ccp_inst instance);
+    uint32 brake_distance;    /*velocity + (velocity - accel) + ... + accel*/
+    uint16 duty;
+    uint16 target;
+    uint16 velocity;
+    uint16 accel;
+    uint16 max_velocity;      /*Multiple of accel*/
+    uint8 direction;
+    uint8 status;
+}pwm_ramp_channel_t;
+
+static pwm_ramp_channel_t pwm_ramp_channels[PWM_RAMP_CHANNELS];
+static uint8 pwm_ramp_timer_started = 0;
+#if PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER1
+static timer1_t pwm_ramp_timer1;
+#else
+static timer3_t pwm_ramp_timer3;
+#endif
+
+static Std_ReturnType pwm_ramp_timer_start(void);
+static void pwm_ramp_step_isr(void);
+static void pwm_ramp_step_channel(ccp_inst instance);
+
+/**
+ * @brief attach a ramp channel to an initialized PWM instance, write its start duty
+ *        and start the step timer(first call). Calling it again resets the channel.
+ * @param ramp pointer points to pwm_ramp_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType pwm_ramp_initialize(const pwm_ramp_t *ramp)
+{
+    Std_ReturnType ret = E_OK;
+    pwm_ramp_channel_t *l_channel = NULL;
+    uint32 l_steps = 0;
+    uint16 l_max_velocity = 0;
+    uint16 l_accel = 0;
+    uint8 l_step_ie_status = 0;
+    if((NULL == ramp) || (NULL == ramp -> pwm) || (ramp -> pwm -> ccp_inst > CCP2_INST) ||
+       (ramp -> profile > PWM_RAMP_S_CURVE))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Slew rate: CCP_PWM_DUTY_Q16_FULL over the steps of full_scale_ms*/
+        l_steps = ramp -> full_scale_ms / PWM_RAMP_CFG_STEP_MS;
+        if(0 == l_steps)
+        {
+            l_steps = 1;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        l_max_velocity = (uint16)(CCP_PWM_DUTY_Q16_FULL / l_steps);
+        if(0 == l_max_velocity)
+        {
+            l_max_velocity = 1;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        l_accel = l_max_velocity;
+        if(PWM_RAMP_S_CURVE == ramp -> profile)
+        {
+            l_steps = ramp -> accel_ms / PWM_RAMP_CFG_STEP_MS;
+            if(l_steps > 1)
+            {
+                l_accel = (uint16)(l_max_velocity / l_steps);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(0 == l_accel)
+            {
+                l_accel = 1;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            /*The velocity steps by accel and has to land on the maximum*/
+            l_max_velocity = (l_max_velocity / l_accel) * l_accel;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        ret = CCP_PWM_SetDutyQ16(ramp -> pwm , ramp -> start_duty);
+        if(E_OK == ret)
+        {
+            l_step_ie_status = PWM_RAMP_STEP_IE;
+            PWM_RAMP_STEP_InterruptDisable();
+            l_channel = &pwm_ramp_channels[ramp -> pwm -> ccp_inst];
+            l_channel -> pwm = ramp -> pwm;
+            l_channel -> ramp_done_callback = ramp -> ramp_done_callback;
+            l_channel -> brake_distance = 0;
+            l_channel -> duty = ramp -> start_duty;
+            l_channel -> target = ramp -> start_duty;
+            l_channel -> velocity = 0;
+            l_channel -> accel = l_accel;
+            l_channel -> max_velocity = l_max_velocity;
+            l_channel -> direction = PWM_RAMP_DIRECTION_UP;
+            l_channel -> status = PWM_RAMP_IDLE;
+            PWM_RAMP_STEP_IE = l_step_ie_status;
+            if(0 == pwm_ramp_timer_started)
+            {
+                ret = pwm_ramp_timer_start();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief ramp a channel toward a new duty, also while a ramp is running(the
+ *        velocity is kept). ramp_done_callback is called when the target is reached.
+ * @param instance CCP1_INST or CCP2_INST.
+ * @param target_duty Q16 duty(CCP_PWM_DUTY_Q16_FULL = 100%).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the channel is not initialized.
+ */
+Std_ReturnType pwm_ramp_set_target(ccp_inst instance , uint16 target_duty)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_step_ie_status = 0;
+    if((instance > CCP2_INST) || (NULL == pwm_ramp_channels[instance].pwm))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_step_ie_status = PWM_RAMP_STEP_IE;
+        PWM_RAMP_STEP_InterruptDisable();
+        pwm_ramp_channels[instance].target = target_duty;
+        pwm_ramp_channels[instance].status = PWM_RAMP_RUNNING;
+        PWM_RAMP_STEP_IE = l_step_ie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief stop a ramp at the current duty(no callback).
+ * @param instance CCP1_INST or CCP2_INST.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the channel is not initialized.
+ */
+Std_ReturnType pwm_ramp_stop(ccp_inst instance)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_step_ie_status = 0;
+    if((instance > CCP2_INST) || (NULL == pwm_ramp_channels[instance].pwm))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_step_ie_status = PWM_RAMP_STEP_IE;
+        PWM_RAMP_STEP_InterruptDisable();
+        pwm_ramp_channels[instance].target = pwm_ramp_channels[instance].duty;
+        pwm_ramp_channels[instance].velocity = 0;
+        pwm_ramp_channels[instance].brake_distance = 0;
+        pwm_ramp_channels[instance].status = PWM_RAMP_IDLE;
+        PWM_RAMP_STEP_IE = l_step_ie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief get the duty last written by the ramp.
+ * @param instance CCP1_INST or CCP2_INST.
+ * @param duty pointer to store the Q16 duty.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType pwm_ramp_get_duty(ccp_inst instance , uint16 *duty)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_step_ie_status = 0;
+    if((NULL == duty) || (instance > CCP2_INST) || (NULL == pwm_ramp_channels[instance].pwm))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_step_ie_status = PWM_RAMP_STEP_IE;
+        PWM_RAMP_STEP_InterruptDisable();
+        *duty = pwm_ramp_channels[instance].duty;
+        PWM_RAMP_STEP_IE = l_step_ie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief check if a channel is still ramping.
+ * @param instance CCP1_INST or CCP2_INST.
+ * @param status pointer to store PWM_RAMP_RUNNING or PWM_RAMP_IDLE.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType pwm_ramp_get_status(ccp_inst instance , uint8 *status)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == status) || (instance > CCP2_INST) || (NULL == pwm_ramp_channels[instance].pwm))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *status = pwm_ramp_channels[instance].status;
+    }
+    return ret;
+}
+
+/*Step timer: PWM_RAMP_CFG_STEP_MS per overflow(the prescaler values are the same on Timer1 and Timer3)*/
+static Std_ReturnType pwm_ramp_timer_start(void)
+{
+    Std_ReturnType ret = E_OK;
+#if PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER1
+    pwm_ramp_timer1.TIMER1_InterruptHandler = pwm_ramp_step_isr;
+    pwm_ramp_timer1.priority = PWM_RAMP_CFG_PRIORITY;
+    pwm_ramp_timer1.prescaler_value = PWM_RAMP_STEP_PRESCALER;
+    pwm_ramp_timer1.timer1_mode = TIMER1_TIMER_MODE;
+    pwm_ramp_timer1.timer1_counter_mode = TIMER1_SYNC_COUNTER_MODE;
+    pwm_ramp_timer1.timer1_osc_cfg = TIMER1_OSC_DISABLE;
+    pwm_ramp_timer1.timer1_reg_wr_mode = TIMER1_RW_REGESTER_16BIT_MODE;
+    pwm_ramp_timer1.timer1_preload_value = PWM_RAMP_STEP_PRELOAD;
+    ret = Timer1_Init(&pwm_ramp_timer1);
+#else
+    pwm_ramp_timer3.TIMER3_InterruptHandler = pwm_ramp_step_isr;
+    pwm_ramp_timer3.priority = PWM_RAMP_CFG_PRIORITY;
+    pwm_ramp_timer3.prescaler_value = PWM_RAMP_STEP_PRESCALER;
+    pwm_ramp_timer3.timer3_mode = TIMER3_TIMER_MODE;
+    pwm_ramp_timer3.timer3_counter_mode = TIMER3_SYNC_COUNTER_MODE;
+    pwm_ramp_timer3.timer3_reg_wr_mode = TIMER3_RW_REGESTER_16BIT_MODE;
+    pwm_ramp_timer3.timer3_preload_value = PWM_RAMP_STEP_PRELOAD;
+    ret = Timer3_Init(&pwm_ramp_timer3);
+#endif
+    if(E_OK == ret)
+    {
+        pwm_ramp_timer_started = 1;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+/*Step timer handler: one step of every running channel*/
+static void pwm_ramp_step_isr(void)
+{
+    pwm_ramp_step_channel(CCP1_INST);
+    pwm_ramp_step_channel(CCP2_INST);
+}
+
+static void pwm_ramp_step_channel(ccp_inst instance)
+{
+    pwm_ramp_channel_t *l_channel = &pwm_ramp_channels[instance];
+    uint16 l_remaining = 0;
+    uint8 l_ahead = 0;
+    uint8 l_done = 0;
+    if(PWM_RAMP_RUNNING == l_channel -> status)
+    {
+        if(0 == l_channel -> velocity)
+        {
+            /*Standing: head for the target*/
+            if(l_channel -> target >= l_channel -> duty)
+            {
+                l_channel -> direction = PWM_RAMP_DIRECTION_UP;
+            }
+            else
+            {
+                l_channel -> direction = PWM_RAMP_DIRECTION_DOWN;
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if((PWM_RAMP_DIRECTION_UP == l_channel -> direction) && (l_channel -> target >= l_channel -> duty))
+        {
+            l_ahead = 1;
+            l_remaining = l_channel -> target - l_channel -> duty;
+        }
+        else if((PWM_RAMP_DIRECTION_DOWN == l_channel -> direction) && (l_channel -> target <= l_channel -> duty))
+        {
+            l_ahead = 1;
+            l_remaining = l_channel -> duty - l_channel -> target;
+        }
+        else
+        {
+            /*Target behind the motion*/
+        }
+        if(l_ahead && (l_channel -> velocity < l_channel -> max_velocity) &&
+           ((l_channel -> brake_distance + l_channel -> velocity + l_channel -> accel) <= l_remaining))
+        {
+            l_channel -> velocity += l_channel -> accel;
+            l_channel -> brake_distance += l_channel -> velocity;
+        }
+        else if(l_ahead && (l_channel -> brake_distance <= l_remaining))
+        {
+            /*NOTHING*/
+        }
+        else if(l_channel -> velocity > 0)
+        {
+            l_channel -> brake_distance -= l_channel -> velocity;
+            l_channel -> velocity -= l_channel -> accel;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(l_ahead && ((0 == l_channel -> velocity) || (l_channel -> velocity >= l_remaining)))
+        {
+            /*The last step is shorter than accel at most*/
+            l_channel -> duty = l_channel -> target;
+            l_done = 1;
+        }
+        else if(PWM_RAMP_DIRECTION_UP == l_channel -> direction)
+        {
+            if(l_channel -> velocity > (CCP_PWM_DUTY_Q16_FULL - l_channel -> duty))
+            {
+                l_channel -> duty = CCP_PWM_DUTY_Q16_FULL;
+                l_channel -> velocity = 0;
+            }
+            else
+            {
+                l_channel -> duty += l_channel -> velocity;
+            }
+        }
+        else
+        {
+            if(l_channel -> velocity > l_channel -> duty)
+            {
+                l_channel -> duty = 0;
+                l_channel -> velocity = 0;
+            }
+            else
+            {
+                l_channel -> duty -= l_channel -> velocity;
+            }
+        }
+        if(0 == l_channel -> velocity)
+        {
+            l_channel -> brake_distance = 0;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        CCP_PWM_SetDutyQ16(l_channel -> pwm , l_channel -> duty);
+        if(l_done)
+        {
+            l_channel -> velocity = 0;
+            l_channel -> brake_distance = 0;
+            l_channel -> status = PWM_RAMP_IDLE;
+            if(l_channel -> ramp_done_callback)
+            {
+                l_channel -> ramp_done_callback(instance);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
@@ -0,0 +1,72 @@
+/*
+ * File:   ecu_pwm_ramp.h
+ */
+
+#ifndef ECU_PWM_RAMP_H
+#define	ECU_PWM_RAMP_H
+
+/******************Section: Includes**********************/
+#include "ecu_pwm_ramp_cfg.h"
+#include "../../MCAL_Layer/CCP1/hal_ccp1.h"
+
+/******************Section: Macros Declarations***********/
+#define PWM_RAMP_CHANNELS            2U    /*CCP1_INST and CCP2_INST*/
+
+#define PWM_RAMP_IDLE                0x00U
+#define PWM_RAMP_RUNNING             0x01U
+
+/*Step timer ticks(Fosc / 4), the prescaler is only used when one step doesn't fit 16 bits*/
+#define PWM_RAMP_STEP_TICKS          (PWM_RAMP_CFG_STEP_MS * ((_XTAL_FREQ / 4UL) / 1000UL))
+
+#if PWM_RAMP_STEP_TICKS <= 0x10000UL
+#define PWM_RAMP_STEP_PRESCALER      TIMER1_PRESCALER_DIV_BY_1
+#define PWM_RAMP_STEP_PRELOAD        ((uint16)(0x10000UL - PWM_RAMP_STEP_TICKS))
+#elif (PWM_RAMP_STEP_TICKS / 8UL) <= 0x10000UL
+#define PWM_RAMP_STEP_PRESCALER      TIMER1_PRESCALER_DIV_BY_8
+#define PWM_RAMP_STEP_PRELOAD        ((uint16)(0x10000UL - (PWM_RAMP_STEP_TICKS / 8UL)))
+#else
+#error "PWM_RAMP_CFG_STEP_MS is too long for the 16-bit step timer"
+#endif
+
+#if PWM_RAMP_CFG_STEP_MS == 0UL
+#error "PWM_RAMP_CFG_STEP_MS must be at least 1"
+#endif
+
+#if (PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER1) && \
+    (TIMER1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "The ramp is stepped from the TIMER1 interrupt"
+#elif (PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER3) && \
+      (TIMER3_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "The ramp is stepped from the TIMER3 interrupt"
+#endif
+
+/*Modbus RTU owns Timer3, caught where both modules are included(e.g. the application)*/
+#if defined(ECU_MODBUS_RTU_H) && (PWM_RAMP_CFG_STEP_TIMER == PWM_RAMP_STEP_TIMER3)
+#error "Timer3 is owned by Modbus RTU, select PWM_RAMP_STEP_TIMER1 for the ramp"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    PWM_RAMP_LINEAR = 0,    /*Constant slew rate*/
+    PWM_RAMP_S_CURVE        /*Slew rate ramps up/down over accel_ms at both ends*/
+}pwm_ramp_profile_t;
+
+typedef struct{
+    const ccp_t *pwm;                                 /*Initialized CCP in PWM mode*/
+    void(*ramp_done_callback)(ccp_inst instance);     /*Target reached(step interrupt context), may be NULL*/
+    uint16 full_scale_ms;                             /*Slew rate: time of a 0 - 100% ramp*/
+    uint16 accel_ms;                                  /*S-curve: time to reach the slew rate*/
+    uint16 start_duty;                                /*Q16 duty written at initialize(0 for soft-start)*/
+    pwm_ramp_profile_t profile;
+}pwm_ramp_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType pwm_ramp_initialize(const pwm_ramp_t *ramp);
+Std_ReturnType pwm_ramp_set_target(ccp_inst instance , uint16 target_duty);
+Std_ReturnType pwm_ramp_stop(ccp_inst instance);
+Std_ReturnType pwm_ramp_get_duty(ccp_inst instance , uint16 *duty);
+Std_ReturnType pwm_ramp_get_status(ccp_inst instance , uint8 *status);
+
+#endif	/* ECU_PWM_RAMP_H */
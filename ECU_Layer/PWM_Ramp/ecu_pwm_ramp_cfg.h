@@ -0,0 +1,35 @@
+/*
+ * File:   ecu_pwm_ramp_cfg.h
+ */
+
+#ifndef ECU_PWM_RAMP_CFG_H
+#define	ECU_PWM_RAMP_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define PWM_RAMP_STEP_TIMER1         0U
+#define PWM_RAMP_STEP_TIMER3         1U
+
+/*
+ * Timer owned by the ramp engine(its interrupt handler and preload), the overflow steps
+ * every channel. The other users of these timers:
+ *   Timer3: Modbus RTU(inter-frame gap, always), servo and CCP capture with a Timer3 selection.
+ *   Timer1: servo and CCP capture with a Timer1 selection, borrowed by the I2C diagnostics.
+ * Only one of them can run on a timer at a time.
+ */
+#define PWM_RAMP_CFG_STEP_TIMER      PWM_RAMP_STEP_TIMER1
+
+/*Step period, the duty changes once per step*/
+#define PWM_RAMP_CFG_STEP_MS         1UL
+
+/*Priority of the step interrupt*/
+#define PWM_RAMP_CFG_PRIORITY        INTERRUPT_LOW_PRIORITY
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_PWM_RAMP_CFG_H */
@@ -0,0 +1,331 @@
+/*
+ * File:   ecu_packet_link.c
+ */
+
+#include "ecu_packet_link.h"
+
+#if PACKET_LINK_CFG_CRC_TABLE == PACKET_LINK_CRC_BYTE_TABLE
+static const uint16 packet_link_crc_table[256] = {
+    0x0000 , 0x1021 , 0x2042 , 0x3063 , 0x4084 , 0x50A5 , 0x60C6 , 0x70E7 ,
+    0x8108 , 0x9129 , 0xA14A , 0xB16B , 0xC18C , 0xD1AD , 0xE1CE , 0xF1EF ,
+    0x1231 , 0x0210 , 0x3273 , 0x2252 , 0x52B5 , 0x4294 , 0x72F7 , 0x62D6 ,
+    0x9339 , 0x8318 , 0xB37B , 0xA35A , 0xD3BD , 0xC39C , 0xF3FF , 0xE3DE ,
+    0x2462 , 0x3443 , 0x0420 , 0x1401 , 0x64E6 , 0x74C7 , 0x44A4 , 0x5485 ,
+    0xA56A , 0xB54B , 0x8528 , 0x9509 , 0xE5EE , 0xF5CF , 0xC5AC , 0xD58D ,
+    0x3653 , 0x2672 , 0x1611 , 0x0630 , 0x76D7 , 0x66F6 , 0x5695 , 0x46B4 ,
+    0xB75B , 0xA77A , 0x9719 , 0x8738 , 0xF7DF , 0xE7FE , 0xD79D , 0xC7BC ,
+    0x48C4 , 0x58E5 , 0x6886 , 0x78A7 , 0x0840 , 0x1861 , 0x2802 , 0x3823 ,
+    0xC9CC , 0xD9ED , 0xE98E , 0xF9AF , 0x8948 , 0x9969 , 0xA90A , 0xB92B ,
+    0x5AF5 , 0x4AD4 , 0x7AB7 , 0x6A96 , 0x1A71 , 0x0A50 , 0x3A33 , 0x2A12 ,
+    0xDBFD , 0xCBDC , 0xFBBF , 0xEB9E , 0x9B79 , 0x8B58 , 0xBB3B , 0xAB1A ,
+    0x6CA6 , 0x7C87 , 0x4CE4 , 0x5CC5 , 0x2C22 , 0x3C03 , 0x0C60 , 0x1C41 ,
+    0xEDAE , 0xFD8F , 0xCDEC , 0xDDCD , 0xAD2A , 0xBD0B , 0x8D68 , 0x9D49 ,
+    0x7E97 , 0x6EB6 , 0x5ED5 , 0x4EF4 , 0x3E13 , 0x2E32 , 0x1E51 , 0x0E70 ,
+    0xFF9F , 0xEFBE , 0xDFDD , 0xCFFC , 0xBF1B , 0xAF3A , 0x9F59 , 0x8F78 ,
+    0x9188 , 0x81A9 , 0xB1CA , 0xA1EB , 0xD10C , 0xC12D , 0xF14E , 0xE16F ,
+    0x1080 , 0x00A1 , 0x30C2 , 0x20E3 , 0x5004 , 0x4025 , 0x7046 , 0x6067 ,
+    0x83B9 , 0x9398 , 0xA3FB , 0xB3DA , 0xC33D , 0xD31C , 0xE37F , 0xF35E ,
+    0x02B1 , 0x1290 , 0x22F3 , 0x32D2 , 0x4235 , 0x5214 , 0x6277 , 0x7256 ,
+    0xB5EA , 0xA5CB , 0x95A8 , 0x8589 , 0xF56E , 0xE54F , 0xD52C , 0xC50D ,
+    0x34E2 , 0x24C3 , 0x14A0 , 0x0481 , 0x7466 , 0x6447 , 0x5424 , 0x4405 ,
+    0xA7DB , 0xB7FA , 0x8799 , 0x97B8 , 0xE75F , 0xF77E , 0xC71D , 0xD73C ,
+    0x26D3 , 0x36F2 , 0x0691 , 0x16B0 , 0x6657 , 0x7676 , 0x4615 , 0x5634 ,
+    0xD94C , 0xC96D , 0xF90E , 0xE92F , 0x99C8 , 0x89E9 , 0xB98A , 0xA9AB ,
+    0x5844 , 0x4865 , 0x7806 , 0x6827 , 0x18C0 , 0x08E1 , 0x3882 , 0x28A3 ,
+    0xCB7D , 0xDB5C , 0xEB3F , 0xFB1E , 0x8BF9 , 0x9BD8 , 0xABBB , 0xBB9A ,
+    0x4A75 , 0x5A54 , 0x6A37 , 0x7A16 , 0x0AF1 , 0x1AD0 , 0x2AB3 , 0x3A92 ,
+    0xFD2E , 0xED0F , 0xDD6C , 0xCD4D , 0xBDAA , 0xAD8B , 0x9DE8 , 0x8DC9 ,
+    0x7C26 , 0x6C07 , 0x5C64 , 0x4C45 , 0x3CA2 , 0x2C83 , 0x1CE0 , 0x0CC1 ,
+    0xEF1F , 0xFF3E , 0xCF5D , 0xDF7C , 0xAF9B , 0xBFBA , 0x8FD9 , 0x9FF8 ,
+    0x6E17 , 0x7E36 , 0x4E55 , 0x5E74 , 0x2E93 , 0x3EB2 , 0x0ED1 , 0x1EF0
+};
+#else
+static const uint16 packet_link_crc_table[16] = {
+    0x0000 , 0x1021 , 0x2042 , 0x3063 , 0x4084 , 0x50A5 , 0x60C6 , 0x70E7 ,
+    0x8108 , 0x9129 , 0xA14A , 0xB16B , 0xC18C , 0xD1AD , 0xE1CE , 0xF1EF
+};
+#endif
+
+static const packet_link_t *packet_link_rx_obj = NULL;
+
+/*Receiver state, owned by packet_link_receive_byte(RX ISR context)*/
+static uint8 packet_link_rx_buffer[PACKET_LINK_CFG_MAX_PAYLOAD + PACKET_LINK_CRC_SIZE];
+static uint8 packet_link_rx_length = 0;
+static uint8 packet_link_rx_code_remaining = 0;
+static uint8 packet_link_rx_last_code = 0;
+static uint8 packet_link_rx_discard = 0;
+static uint16 packet_link_rx_crc = PACKET_LINK_CRC_INIT;
+static volatile packet_link_statistics_t packet_link_statistics = {0};
+
+static uint16 packet_link_crc16_update(uint16 crc , uint8 data);
+static uint8 packet_link_frame_byte(const uint8 *payload , uint8 length , uint16 crc , uint8 index);
+static void packet_link_rx_append(uint8 data);
+static void packet_link_rx_reset(void);
+
+/**
+ * @brief register the link object used by the receiver.
+ *        packet_link_receive_byte must be set as the EUSART_RxByteHandler.
+ * @param link pointer points to packet_link_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType packet_link_initialize(const packet_link_t *link)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == link)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        packet_link_rx_reset();
+        packet_link_rx_obj = link;
+    }
+    return ret;
+}
+
+/**
+ * @brief COBS-encode payload + CRC-16 on the fly and stream it to tx_byte,
+ *        followed by the zero delimiter. no copy of the frame is made.
+ * @param link pointer points to packet_link_t data.
+ * @param payload the bytes to send.
+ * @param length number of payload bytes(max PACKET_LINK_CFG_MAX_PAYLOAD).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType packet_link_send(const packet_link_t *link , const uint8 *payload , uint8 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = PACKET_LINK_CRC_INIT;
+    uint8 l_frame_length = 0;
+    uint8 l_index = 0;
+    uint8 l_run = 0;
+    uint8 l_counter = 0;
+    if((NULL == link) || (NULL == link -> tx_byte) || ((NULL == payload) && (0 != length)) ||
+       (length > PACKET_LINK_CFG_MAX_PAYLOAD))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_counter = 0 ; l_counter < length ; l_counter++)
+        {
+            l_crc = packet_link_crc16_update(l_crc , payload[l_counter]);
+        }
+        l_frame_length = length + PACKET_LINK_CRC_SIZE;
+        /*Each block: code byte = run of non-zero bytes + 1, the zero is implied*/
+        while(l_index <= l_frame_length)
+        {
+            l_run = 0;
+            while(((l_index + l_run) < l_frame_length) && (l_run < 254U) &&
+                  (0 != packet_link_frame_byte(payload , length , l_crc , l_index + l_run)))
+            {
+                l_run++;
+            }
+            link -> tx_byte(l_run + 1);
+            for(l_counter = 0 ; l_counter < l_run ; l_counter++)
+            {
+                link -> tx_byte(packet_link_frame_byte(payload , length , l_crc , l_index + l_counter));
+            }
+            l_index += l_run;
+            if(l_run < 254U)
+            {
+                l_index++;/*Skip the zero encoded by this block*/
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        link -> tx_byte(PACKET_LINK_FRAME_DELIMITER);
+    }
+    return ret;
+}
+
+/**
+ * @brief feed one received byte to the incremental COBS decoder.
+ *        the CRC is updated while decoding, a zero byte closes the frame.
+ *        meant to be the EUSART_RxByteHandler(runs in the RX ISR).
+ * @param data the received byte.
+ */
+void packet_link_receive_byte(uint8 data)
+{
+    if(PACKET_LINK_FRAME_DELIMITER == data)
+    {
+        if((0 == packet_link_rx_length) && (0 == packet_link_rx_last_code))
+        {
+            /*Back to back delimiters, idle line*/
+        }
+        else if(packet_link_rx_discard)
+        {
+            /*Already counted*/
+        }
+        else if(0 != packet_link_rx_code_remaining)
+        {
+            packet_link_statistics.cobs_errors++;
+        }
+        else if(packet_link_rx_length < PACKET_LINK_CRC_SIZE)
+        {
+            packet_link_statistics.length_errors++;
+        }
+        else if(0 != packet_link_rx_crc)
+        {
+            packet_link_statistics.crc_errors++;
+        }
+        else
+        {
+            packet_link_statistics.frames_received++;
+            if((NULL != packet_link_rx_obj) && (NULL != packet_link_rx_obj -> frame_received))
+            {
+                packet_link_rx_obj -> frame_received(packet_link_rx_buffer , 
+                                                     packet_link_rx_length - PACKET_LINK_CRC_SIZE);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        packet_link_rx_reset();
+    }
+    else if(packet_link_rx_discard)
+    {
+        /*Wait for the next delimiter to resynchronize*/
+    }
+    else if(0 == packet_link_rx_code_remaining)
+    {
+        /*New block, the previous block implied a zero unless it was a full 0xFF block*/
+        if((0 != packet_link_rx_last_code) && (0xFFU != packet_link_rx_last_code))
+        {
+            packet_link_rx_append(0x00);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        packet_link_rx_last_code = data;
+        packet_link_rx_code_remaining = data - 1;
+    }
+    else
+    {
+        packet_link_rx_append(data);
+        packet_link_rx_code_remaining--;
+    }
+}
+
+/**
+ * @brief take a consistent snapshot of the link counters.
+ * @param statistics pointer to store the counters.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType packet_link_get_statistics(packet_link_statistics_t *statistics)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*The counters are written by the RX ISR, copy until two reads agree*/
+        do
+        {
+            statistics -> frames_received = packet_link_statistics.frames_received;
+            statistics -> crc_errors = packet_link_statistics.crc_errors;
+            statistics -> cobs_errors = packet_link_statistics.cobs_errors;
+            statistics -> length_errors = packet_link_statistics.length_errors;
+        }while((statistics -> frames_received != packet_link_statistics.frames_received) ||
+               (statistics -> crc_errors != packet_link_statistics.crc_errors) ||
+               (statistics -> cobs_errors != packet_link_statistics.cobs_errors) ||
+               (statistics -> length_errors != packet_link_statistics.length_errors));
+    }
+    return ret;
+}
+
+/**
+ * @brief calculate the CRC-16/CCITT-FALSE of a buffer.
+ * @param data the bytes to check.
+ * @param length number of bytes.
+ * @param crc pointer to store the CRC.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType packet_link_crc16(const uint8 *data , uint16 length , uint16 *crc)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_crc = PACKET_LINK_CRC_INIT;
+    uint16 l_counter = 0;
+    if((NULL == data) || (NULL == crc))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_counter = 0 ; l_counter < length ; l_counter++)
+        {
+            l_crc = packet_link_crc16_update(l_crc , data[l_counter]);
+        }
+        *crc = l_crc;
+    }
+    return ret;
+}
+
+static uint16 packet_link_crc16_update(uint16 crc , uint8 data)
+{
+#if PACKET_LINK_CFG_CRC_TABLE == PACKET_LINK_CRC_BYTE_TABLE
+    crc = (uint16)(crc << 8) ^ packet_link_crc_table[(uint8)(crc >> 8) ^ data];
+#else
+    crc = (uint16)(crc << 4) ^ packet_link_crc_table[(uint8)(crc >> 12) ^ (data >> 4)];
+    crc = (uint16)(crc << 4) ^ packet_link_crc_table[(uint8)(crc >> 12) ^ (data & 0x0F)];
+#endif
+    return crc;
+}
+
+/**
+ * @brief byte at index of the virtual frame payload + CRC(big endian).
+ */
+static uint8 packet_link_frame_byte(const uint8 *payload , uint8 length , uint16 crc , uint8 index)
+{
+    uint8 l_data = 0;
+    if(index < length)
+    {
+        l_data = payload[index];
+    }
+    else if(index == length)
+    {
+        l_data = (uint8)(crc >> 8);
+    }
+    else
+    {
+        l_data = (uint8)crc;
+    }
+    return l_data;
+}
+
+static void packet_link_rx_append(uint8 data)
+{
+    if(packet_link_rx_length < sizeof(packet_link_rx_buffer))
+    {
+        packet_link_rx_buffer[packet_link_rx_length] = data;
+        packet_link_rx_length++;
+        packet_link_rx_crc = packet_link_crc16_update(packet_link_rx_crc , data);
+    }
+    else
+    {
+        packet_link_statistics.length_errors++;
+        packet_link_rx_discard = 1;
+    }
+}
+
+static void packet_link_rx_reset(void)
+{
+    packet_link_rx_length = 0;
+    packet_link_rx_code_remaining = 0;
+    packet_link_rx_last_code = 0;
+    packet_link_rx_discard = 0;
+    packet_link_rx_crc = PACKET_LINK_CRC_INIT;
+}
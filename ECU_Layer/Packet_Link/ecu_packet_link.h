@@ -0,0 +1,43 @@
+/*
+ * File:   ecu_packet_link.h
+ */
+
+#ifndef ECU_PACKET_LINK_H
+#define	ECU_PACKET_LINK_H
+
+/******************Section: Includes**********************/
+#include "ecu_packet_link_cfg.h"
+#include "../../MCAL_Layer/USART/hal_usart.h"
+
+/******************Section: Macros Declarations***********/
+#define PACKET_LINK_FRAME_DELIMITER      0x00U
+#define PACKET_LINK_CRC_SIZE             2U
+#define PACKET_LINK_CRC_INIT             0xFFFFU   /*CRC-16/CCITT-FALSE, polynomial 0x1021*/
+
+#if (PACKET_LINK_CFG_MAX_PAYLOAD < 1U) || (PACKET_LINK_CFG_MAX_PAYLOAD > 252U)
+#error "PACKET_LINK_CFG_MAX_PAYLOAD must be between 1 and 252"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+    void (*tx_byte)(uint8 data);                                /*Byte sink, e.g. EUSART_ASYNCH_WriteByteBlocking*/
+    void (*frame_received)(const uint8 *payload , uint8 length);/*Called from the RX ISR for every valid frame*/
+}packet_link_t;
+
+typedef struct{
+    uint16 frames_received;  /*Frames delivered to frame_received*/
+    uint16 crc_errors;       /*Frames dropped because of a CRC mismatch*/
+    uint16 cobs_errors;      /*Frames dropped because a COBS block was cut by a delimiter*/
+    uint16 length_errors;    /*Frames longer than PACKET_LINK_CFG_MAX_PAYLOAD or shorter than the CRC*/
+}packet_link_statistics_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType packet_link_initialize(const packet_link_t *link);
+Std_ReturnType packet_link_send(const packet_link_t *link , const uint8 *payload , uint8 length);
+void packet_link_receive_byte(uint8 data);
+Std_ReturnType packet_link_get_statistics(packet_link_statistics_t *statistics);
+Std_ReturnType packet_link_crc16(const uint8 *data , uint16 length , uint16 *crc);
+
+#endif	/* ECU_PACKET_LINK_H */
@@ -0,0 +1,25 @@
+/*
+ * File:   ecu_packet_link_cfg.h
+ */
+
+#ifndef ECU_PACKET_LINK_CFG_H
+#define	ECU_PACKET_LINK_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define PACKET_LINK_CRC_BYTE_TABLE       0x00U   /*256 entries, fastest, 512 bytes of flash*/
+#define PACKET_LINK_CRC_NIBBLE_TABLE     0x01U   /*16 entries, two lookups per byte, 32 bytes of flash*/
+
+#define PACKET_LINK_CFG_CRC_TABLE        PACKET_LINK_CRC_NIBBLE_TABLE
+
+/*Largest payload accepted by the receiver(max 252 so a frame fits one COBS block)*/
+#define PACKET_LINK_CFG_MAX_PAYLOAD      64U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_PACKET_LINK_CFG_H */
@@ -0,0 +1,504 @@
+/*
+ * File:   ecu_rtc.c
+ */
+
+#include "ecu_rtc.h"
+
+                    /*Register map(same on both parts for the time registers)*/
+#define RTC_REG_SECONDS              0x00U
+#define RTC_REG_DS1307_CONTROL       0x07U
+#define RTC_REG_DS3231_CONTROL       0x0EU
+                    /*Control values for a 1 Hz square wave on SQW*/
+#define RTC_DS1307_CONTROL_SQW_1HZ   0x10U   /*SQWE = 1, RS = 00*/
+#define RTC_DS3231_CONTROL_SQW_1HZ   0x00U   /*EOSC = 0, INTCN = 0, RS = 00*/
+                    /*Register bits*/
+#define RTC_SECONDS_CLOCK_HALT       0x80U   /*DS1307 oscillator stopped*/
+#define RTC_HOURS_12H_MODE           0x40U
+#define RTC_HOURS_PM                 0x20U
+                    /*Burst reads repeated when a SQW edge lands inside them*/
+#define RTC_SYNCHRONIZE_RETRIES      3U
+
+/*Tens digit of a BCD byte(upper nibble) in binary*/
+static const uint8 rtc_bcd_tens[16] = {
+    0 , 10 , 20 , 30 , 40 , 50 , 60 , 70 , 80 , 90 , 100 , 110 , 120 , 130 , 140 , 150
+};
+
+/*Binary 0-99 to BCD*/
+static const uint8 rtc_bin_to_bcd[100] = {
+    0x00 , 0x01 , 0x02 , 0x03 , 0x04 , 0x05 , 0x06 , 0x07 , 0x08 , 0x09 ,
+    0x10 , 0x11 , 0x12 , 0x13 , 0x14 , 0x15 , 0x16 , 0x17 , 0x18 , 0x19 ,
+    0x20 , 0x21 , 0x22 , 0x23 , 0x24 , 0x25 , 0x26 , 0x27 , 0x28 , 0x29 ,
+    0x30 , 0x31 , 0x32 , 0x33 , 0x34 , 0x35 , 0x36 , 0x37 , 0x38 , 0x39 ,
+    0x40 , 0x41 , 0x42 , 0x43 , 0x44 , 0x45 , 0x46 , 0x47 , 0x48 , 0x49 ,
+    0x50 , 0x51 , 0x52 , 0x53 , 0x54 , 0x55 , 0x56 , 0x57 , 0x58 , 0x59 ,
+    0x60 , 0x61 , 0x62 , 0x63 , 0x64 , 0x65 , 0x66 , 0x67 , 0x68 , 0x69 ,
+    0x70 , 0x71 , 0x72 , 0x73 , 0x74 , 0x75 , 0x76 , 0x77 , 0x78 , 0x79 ,
+    0x80 , 0x81 , 0x82 , 0x83 , 0x84 , 0x85 , 0x86 , 0x87 , 0x88 , 0x89 ,
+    0x90 , 0x91 , 0x92 , 0x93 , 0x94 , 0x95 , 0x96 , 0x97 , 0x98 , 0x99
+};
+
+/*Indexed by month - 1, February gets its leap day in rtc_sqw_tick()*/
+static const uint8 rtc_days_in_month[12] = {31 , 28 , 31 , 30 , 31 , 30 , 31 , 31 , 30 , 31 , 30 , 31};
+
+static const mssp_i2c_t *rtc_i2c = NULL;
+static rtc_device_t rtc_device = RTC_DS1307;
+static interrupt_INTx_t rtc_sqw_interrupt;
+static volatile rtc_time_t rtc_time;
+static rtc_alarm_t rtc_alarms[RTC_CFG_ALARM_COUNT];
+static uint8 rtc_initialized = 0;
+
+static void rtc_sqw_tick(void);
+static void rtc_check_alarms(void);
+static void rtc_sqw_interrupt_enable(uint8 enable);
+static uint8 rtc_sqw_interrupt_flag(void);
+static void rtc_sqw_interrupt_flag_clear(void);
+static uint8 rtc_bcd_to_bin(uint8 bcd);
+static Std_ReturnType rtc_check_time(const rtc_time_t *time);
+
+/**
+ * @brief start the oscillator, select the 1 Hz SQW output, hook the SQW edge on the
+ *        INTx and load the cache with one burst read.
+ * @param rtc pointer to rtc_t data(kept by the driver, single instance).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the configuration is invalid or the device doesn't acknowledge.
+ */
+Std_ReturnType rtc_initialize(const rtc_t *rtc)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_control = 0;
+    if((NULL == rtc) || (NULL == rtc -> i2c) || (rtc -> device > RTC_DS3231) ||
+       (rtc -> sqw_interrupt.source > INTERRUPT_EXTERNAL_INT2))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        rtc_initialized = 0;
+        rtc_i2c = rtc -> i2c;
+        rtc_device = rtc -> device;
+        rtc_sqw_interrupt = rtc -> sqw_interrupt;
+        rtc_sqw_interrupt.EXT_InterruptHandler = rtc_sqw_tick;
+        if(RTC_DS1307 == rtc_device)
+        {
+            l_control = RTC_DS1307_CONTROL_SQW_1HZ;
+            ret = MSSP_I2C_Master_Mem_Write(rtc_i2c , RTC_I2C_ADDRESS , RTC_REG_DS1307_CONTROL ,
+                                            I2C_MEM_ADDRESS_8BIT , &l_control , 1);
+        }
+        else
+        {
+            l_control = RTC_DS3231_CONTROL_SQW_1HZ;
+            ret = MSSP_I2C_Master_Mem_Write(rtc_i2c , RTC_I2C_ADDRESS , RTC_REG_DS3231_CONTROL ,
+                                            I2C_MEM_ADDRESS_8BIT , &l_control , 1);
+        }
+        if(E_OK == ret)
+        {
+            ret = Interrupt_INTx_Init(&rtc_sqw_interrupt);
+            /*Kept disabled until the cache holds the time*/
+            rtc_sqw_interrupt_enable(0);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(E_OK == ret)
+        {
+            rtc_initialized = 1;
+            ret = rtc_synchronize();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief reload the cache from the device with one 7-register burst read, the read is
+ *        repeated if a SQW edge(seconds update) happens while it runs.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the driver isn't initialized, the bus transfer failed or the
+ *                     device time is invalid(the cache is kept).
+ */
+Std_ReturnType rtc_synchronize(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_registers[RTC_TIME_REGISTERS] = {0};
+    uint8 l_retries = 0;
+    uint8 l_hours = 0;
+    rtc_time_t l_time;
+    if(0 == rtc_initialized)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        rtc_sqw_interrupt_enable(0);
+        do
+        {
+            rtc_sqw_interrupt_flag_clear();
+            ret = MSSP_I2C_Master_Mem_Read(rtc_i2c , RTC_I2C_ADDRESS , RTC_REG_SECONDS , I2C_MEM_ADDRESS_8BIT ,
+                                           l_registers , RTC_TIME_REGISTERS);
+            l_retries++;
+        }while((E_OK == ret) && (1 == rtc_sqw_interrupt_flag()) && (l_retries < RTC_SYNCHRONIZE_RETRIES));
+        if((E_OK == ret) && (RTC_DS1307 == rtc_device) && (l_registers[0] & RTC_SECONDS_CLOCK_HALT))
+        {
+            /*First power-up of a DS1307: start the oscillator*/
+            l_registers[0] &= (uint8)~RTC_SECONDS_CLOCK_HALT;
+            ret = MSSP_I2C_Master_Mem_Write(rtc_i2c , RTC_I2C_ADDRESS , RTC_REG_SECONDS , I2C_MEM_ADDRESS_8BIT ,
+                                            l_registers , 1);
+            rtc_sqw_interrupt_flag_clear();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(E_OK == ret)
+        {
+            l_time.seconds = rtc_bcd_to_bin(l_registers[0] & 0x7FU);
+            l_time.minutes = rtc_bcd_to_bin(l_registers[1] & 0x7FU);
+            if(l_registers[2] & RTC_HOURS_12H_MODE)
+            {
+                l_hours = rtc_bcd_to_bin(l_registers[2] & 0x1FU);
+                if(12 == l_hours)
+                {
+                    l_hours = 0;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                if(l_registers[2] & RTC_HOURS_PM)
+                {
+                    l_hours += 12;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            else
+            {
+                l_hours = rtc_bcd_to_bin(l_registers[2] & 0x3FU);
+            }
+            l_time.hours = l_hours;
+            l_time.day = l_registers[3] & 0x07U;
+            l_time.date = rtc_bcd_to_bin(l_registers[4] & 0x3FU);
+            l_time.month = rtc_bcd_to_bin(l_registers[5] & 0x1FU);  /*DS3231 century bit masked*/
+            l_time.year = rtc_bcd_to_bin(l_registers[6]);
+            /*A device that lost its time(or a corrupted read) must not reach the cache*/
+            ret = rtc_check_time(&l_time);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(E_OK == ret)
+        {
+            rtc_time.seconds = l_time.seconds;
+            rtc_time.minutes = l_time.minutes;
+            rtc_time.hours = l_time.hours;
+            rtc_time.day = l_time.day;
+            rtc_time.date = l_time.date;
+            rtc_time.month = l_time.month;
+            rtc_time.year = l_time.year;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        /*An edge after the last read is served by the ISR once enabled*/
+        rtc_sqw_interrupt_enable(1);
+    }
+    return ret;
+}
+
+/**
+ * @brief copy the cached time(no bus traffic).
+ * @param time pointer to store the time.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType rtc_get_time(rtc_time_t *time)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == time) || (0 == rtc_initialized))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        rtc_sqw_interrupt_enable(0);
+        time -> seconds = rtc_time.seconds;
+        time -> minutes = rtc_time.minutes;
+        time -> hours = rtc_time.hours;
+        time -> day = rtc_time.day;
+        time -> date = rtc_time.date;
+        time -> month = rtc_time.month;
+        time -> year = rtc_time.year;
+        rtc_sqw_interrupt_enable(1);
+    }
+    return ret;
+}
+
+/**
+ * @brief write the time to the device(24-hour mode, one burst) and the cache, writing the
+ *        seconds register restarts the device's 1 second countdown.
+ * @param time the new time.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means a field is out of range, the driver isn't initialized
+ *                     or the bus transfer failed.
+ */
+Std_ReturnType rtc_set_time(const rtc_time_t *time)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_registers[RTC_TIME_REGISTERS] = {0};
+    if((0 == rtc_initialized) || (E_NOT_OK == rtc_check_time(time)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_registers[0] = rtc_bin_to_bcd[time -> seconds];  /*CH = 0 keeps the DS1307 running*/
+        l_registers[1] = rtc_bin_to_bcd[time -> minutes];
+        l_registers[2] = rtc_bin_to_bcd[time -> hours];
+        l_registers[3] = time -> day;
+        l_registers[4] = rtc_bin_to_bcd[time -> date];
+        l_registers[5] = rtc_bin_to_bcd[time -> month];
+        l_registers[6] = rtc_bin_to_bcd[time -> year];
+        rtc_sqw_interrupt_enable(0);
+        ret = MSSP_I2C_Master_Mem_Write(rtc_i2c , RTC_I2C_ADDRESS , RTC_REG_SECONDS , I2C_MEM_ADDRESS_8BIT ,
+                                        l_registers , RTC_TIME_REGISTERS);
+        if(E_OK == ret)
+        {
+            rtc_time.seconds = time -> seconds;
+            rtc_time.minutes = time -> minutes;
+            rtc_time.hours = time -> hours;
+            rtc_time.day = time -> day;
+            rtc_time.date = time -> date;
+            rtc_time.month = time -> month;
+            rtc_time.year = time -> year;
+            rtc_sqw_interrupt_flag_clear();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        rtc_sqw_interrupt_enable(1);
+    }
+    return ret;
+}
+
+/**
+ * @brief set or clear a software alarm, it's matched against the cache on every SQW tick.
+ * @param alarm_index 0 .. RTC_CFG_ALARM_COUNT - 1.
+ * @param alarm the alarm(fields may be RTC_ALARM_ANY), NULL disables it.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the index or a field is out of range or the handler is NULL.
+ */
+Std_ReturnType rtc_set_alarm(uint8 alarm_index , const rtc_alarm_t *alarm)
+{
+    Std_ReturnType ret = E_OK;
+    if((alarm_index >= RTC_CFG_ALARM_COUNT) || (0 == rtc_initialized))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((NULL != alarm) && ((NULL == alarm -> Alarm_Handler) ||
+            ((RTC_ALARM_ANY != alarm -> hours) && (alarm -> hours > 23)) ||
+            ((RTC_ALARM_ANY != alarm -> minutes) && (alarm -> minutes > 59)) ||
+            ((RTC_ALARM_ANY != alarm -> seconds) && (alarm -> seconds > 59))))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        rtc_sqw_interrupt_enable(0);
+        if(NULL == alarm)
+        {
+            rtc_alarms[alarm_index].Alarm_Handler = NULL;
+        }
+        else
+        {
+            rtc_alarms[alarm_index] = *alarm;
+        }
+        rtc_sqw_interrupt_enable(1);
+    }
+    return ret;
+}
+
+/*SQW edge: the device has just advanced its seconds, follow it in the cache*/
+static void rtc_sqw_tick(void)
+{
+    uint8 l_days = 0;
+    rtc_time.seconds++;
+    if(rtc_time.seconds > 59)
+    {
+        rtc_time.seconds = 0;
+        rtc_time.minutes++;
+        if(rtc_time.minutes > 59)
+        {
+            rtc_time.minutes = 0;
+            rtc_time.hours++;
+            if(rtc_time.hours > 23)
+            {
+                rtc_time.hours = 0;
+                rtc_time.day = (rtc_time.day >= 7) ? 1 : (rtc_time.day + 1);
+                if((rtc_time.month >= 1) && (rtc_time.month <= 12))
+                {
+                    l_days = rtc_days_in_month[rtc_time.month - 1];
+                    if((2 == rtc_time.month) && (0 == (rtc_time.year & 0x03U)))
+                    {
+                        l_days++;
+                    }
+                    else
+                    {
+                        /*NOTHING*/
+                    }
+                }
+                else
+                {
+                    /*No valid date cached(never synchronized): l_days stays 0, the date restarts at 1*/
+                }
+                rtc_time.date++;
+                if(rtc_time.date > l_days)
+                {
+                    rtc_time.date = 1;
+                    rtc_time.month++;
+                    if(rtc_time.month > 12)
+                    {
+                        rtc_time.month = 1;
+                        rtc_time.year = (rtc_time.year >= 99) ? 0 : (rtc_time.year + 1);
+                    }
+                    else
+                    {
+                        /*NOTHING*/
+                    }
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    rtc_check_alarms();
+}
+
+static void rtc_check_alarms(void)
+{
+    uint8 l_index = 0;
+    for(l_index = 0 ; l_index < RTC_CFG_ALARM_COUNT ; l_index++)
+    {
+        if((NULL != rtc_alarms[l_index].Alarm_Handler) &&
+           ((RTC_ALARM_ANY == rtc_alarms[l_index].seconds) || (rtc_alarms[l_index].seconds == rtc_time.seconds)) &&
+           ((RTC_ALARM_ANY == rtc_alarms[l_index].minutes) || (rtc_alarms[l_index].minutes == rtc_time.minutes)) &&
+           ((RTC_ALARM_ANY == rtc_alarms[l_index].hours) || (rtc_alarms[l_index].hours == rtc_time.hours)))
+        {
+            rtc_alarms[l_index].Alarm_Handler();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+}
+
+/*Only the INTx enable bit, the flag keeps latching edges while it's disabled*/
+static void rtc_sqw_interrupt_enable(uint8 enable)
+{
+    switch(rtc_sqw_interrupt.source)
+    {
+        case INTERRUPT_EXTERNAL_INT0:
+            INTCONbits.INT0IE = enable;
+            break;
+        case INTERRUPT_EXTERNAL_INT1:
+            INTCON3bits.INT1IE = enable;
+            break;
+        case INTERRUPT_EXTERNAL_INT2:
+            INTCON3bits.INT2IE = enable;
+            break;
+        default:
+            break;
+    }
+}
+
+static uint8 rtc_sqw_interrupt_flag(void)
+{
+    uint8 l_flag = 0;
+    switch(rtc_sqw_interrupt.source)
+    {
+        case INTERRUPT_EXTERNAL_INT0:
+            l_flag = INTCONbits.INT0IF;
+            break;
+        case INTERRUPT_EXTERNAL_INT1:
+            l_flag = INTCON3bits.INT1IF;
+            break;
+        case INTERRUPT_EXTERNAL_INT2:
+            l_flag = INTCON3bits.INT2IF;
+            break;
+        default:
+            break;
+    }
+    return l_flag;
+}
+
+static void rtc_sqw_interrupt_flag_clear(void)
+{
+    switch(rtc_sqw_interrupt.source)
+    {
+        case INTERRUPT_EXTERNAL_INT0:
+            EXT_INT0_InterruptFlagClear();
+            break;
+        case INTERRUPT_EXTERNAL_INT1:
+            EXT_INT1_InterruptFlagClear();
+            break;
+        case INTERRUPT_EXTERNAL_INT2:
+            EXT_INT2_InterruptFlagClear();
+            break;
+        default:
+            break;
+    }
+}
+
+static uint8 rtc_bcd_to_bin(uint8 bcd)
+{
+    return (uint8)(rtc_bcd_tens[bcd >> 4] + (bcd & 0x0FU));
+}
+
+static Std_ReturnType rtc_check_time(const rtc_time_t *time)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == time)
+    {
+        ret = E_NOT_OK;
+    }
+    else if((time -> seconds > 59) || (time -> minutes > 59) || (time -> hours > 23) ||
+            (time -> day < 1) || (time -> day > 7) || (time -> month < 1) || (time -> month > 12) ||
+            (time -> year > 99) || (time -> date < 1) ||
+            (time -> date > (rtc_days_in_month[time -> month - 1] + (((2 == time -> month) && (0 == (time -> year & 0x03U))) ? 1 : 0))))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
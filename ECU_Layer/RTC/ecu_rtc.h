@@ -0,0 +1,62 @@
+/*
+ * File:   ecu_rtc.h
+ */
+
+#ifndef ECU_RTC_H
+#define	ECU_RTC_H
+
+/******************Section: Includes**********************/
+#include "ecu_rtc_cfg.h"
+#include "../../MCAL_Layer/I2C/hal_i2c.h"
+#include "../../MCAL_Layer/Interrupt/mcal_external_interrupt.h"
+
+/******************Section: Macros Declarations***********/
+#define RTC_I2C_ADDRESS              0x68U
+#define RTC_TIME_REGISTERS           7U
+/*Alarm field that matches any value(e.g. seconds 0 with the others ANY: every minute)*/
+#define RTC_ALARM_ANY                0xFFU
+
+#if EXTERNAL_INTERRUPT_INTx_FEATUER_ENABLE != INTERRUPT_FEATURE_ENABLE
+#error "The RTC cache is advanced by the SQW output on INTx"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    RTC_DS1307 = 0,
+    RTC_DS3231
+}rtc_device_t;
+
+typedef struct{
+    uint8 seconds;     /*0-59*/
+    uint8 minutes;     /*0-59*/
+    uint8 hours;       /*0-23*/
+    uint8 day;         /*Day of the week 1-7*/
+    uint8 date;        /*1-31*/
+    uint8 month;       /*1-12*/
+    uint8 year;        /*0-99(2000-2099)*/
+}rtc_time_t;
+
+typedef struct{
+    const mssp_i2c_t *i2c;              /*Initialized MSSP in master mode*/
+    rtc_device_t device;
+    interrupt_INTx_t sqw_interrupt;     /*INTx wired to SQW(open drain, needs a pull-up),
+                                          falling edge, the handler is set by the driver*/
+}rtc_t;
+
+typedef struct{
+    uint8 hours;                        /*0-23 or RTC_ALARM_ANY*/
+    uint8 minutes;                      /*0-59 or RTC_ALARM_ANY*/
+    uint8 seconds;                      /*0-59 or RTC_ALARM_ANY*/
+    void (*Alarm_Handler)(void);        /*Called from the SQW interrupt*/
+}rtc_alarm_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType rtc_initialize(const rtc_t *rtc);
+Std_ReturnType rtc_synchronize(void);
+Std_ReturnType rtc_get_time(rtc_time_t *time);
+Std_ReturnType rtc_set_time(const rtc_time_t *time);
+Std_ReturnType rtc_set_alarm(uint8 alarm_index , const rtc_alarm_t *alarm);
+
+#endif	/* ECU_RTC_H */
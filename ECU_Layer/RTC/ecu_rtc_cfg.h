@@ -0,0 +1,20 @@
+/*
+ * File:   ecu_rtc_cfg.h
+ */
+
+#ifndef ECU_RTC_CFG_H
+#define	ECU_RTC_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Software alarms checked on every SQW tick*/
+#define RTC_CFG_ALARM_COUNT          2U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_RTC_CFG_H */
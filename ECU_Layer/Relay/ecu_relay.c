@@ -1,82 +1,82 @@
-/* 
- * File:   ecu_relay.c
- * Author: yousg
- *
- * Created on December 9, 2024, 6:39 PM
- */
-
-#include "ecu_relay.h"
-/**
- * 
- * @param _relay
- * @return 
- */
-Std_ReturnType relay_initialize(const relay_t * _relay)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == _relay)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        pin_config_t pin_obj = {
-            .port = _relay -> relay_port,
-            .pin = _relay -> relay_pin,
-            .direction = GPIO_DIRECTION_OUTPUT,
-            .logic = _relay ->relay_staus
-        };
-        gpio_pin_intialize(&pin_obj);
-    }
-    return ret;
-}
-
-/**
- * 
- * @param _relay
- * @return 
- */
-Std_ReturnType relay_turn_on(const relay_t * _relay)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == _relay)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        pin_config_t pin_obj = {
-            .port = _relay -> relay_port,
-            .pin = _relay -> relay_pin,
-            .direction = GPIO_DIRECTION_OUTPUT,
-            .logic = _relay ->relay_staus
-        };
-        gpio_pin_write_logic(&pin_obj , GPIO_HIGH);
-    }
-    return ret;
-}
-
-/**
- * 
- * @param _relay
- * @return 
- */
-Std_ReturnType relay_turn_off(const relay_t * _relay)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == _relay)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        pin_config_t pin_obj = {
-            .port = _relay -> relay_port,
-            .pin = _relay -> relay_pin,
-            .direction = GPIO_DIRECTION_OUTPUT,
-            .logic = _relay ->relay_staus
-        };
-        gpio_pin_write_logic(&pin_obj , GPIO_LOW);
-    }
-    return ret;
+/* 
+ * File:   ecu_relay.c
+ * Author: yousg
+ *
+ * Created on December 9, 2024, 6:39 PM
+ */
+
+#include "ecu_relay.h"
+/**
+ * 
+ * @param _relay
+ * @return 
+ */
+Std_ReturnType relay_initialize(const relay_t * _relay)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _relay)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        pin_config_t pin_obj = {
+            .port = _relay -> relay_port,
+            .pin = _relay -> relay_pin,
+            .direction = GPIO_DIRECTION_OUTPUT,
+            .logic = _relay ->relay_staus
+        };
+        gpio_pin_intialize(&pin_obj);
+    }
+    return ret;
+}
+
+/**
+ * 
+ * @param _relay
+ * @return 
+ */
+Std_ReturnType relay_turn_on(const relay_t * _relay)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _relay)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        pin_config_t pin_obj = {
+            .port = _relay -> relay_port,
+            .pin = _relay -> relay_pin,
+            .direction = GPIO_DIRECTION_OUTPUT,
+            .logic = _relay ->relay_staus
+        };
+        gpio_pin_write_logic(&pin_obj , GPIO_HIGH);
+    }
+    return ret;
+}
+
+/**
+ * 
+ * @param _relay
+ * @return 
+ */
+Std_ReturnType relay_turn_off(const relay_t * _relay)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == _relay)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        pin_config_t pin_obj = {
+            .port = _relay -> relay_port,
+            .pin = _relay -> relay_pin,
+            .direction = GPIO_DIRECTION_OUTPUT,
+            .logic = _relay ->relay_staus
+        };
+        gpio_pin_write_logic(&pin_obj , GPIO_LOW);
+    }
+    return ret;
 }
\ No newline at end of file
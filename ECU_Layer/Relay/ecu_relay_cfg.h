@@ -1,23 +1,23 @@
-/* 
- * File:   ecu_relay_cfg.h
- * Author: yousg
- *
- * Created on December 9, 2024, 6:39 PM
- */
-
-#ifndef ECU_RELAY_CFG_H
-#define	ECU_RELAY_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-
-#endif	/* ECU_RELAY_CFG_H */
-
+/* 
+ * File:   ecu_relay_cfg.h
+ * Author: yousg
+ *
+ * Created on December 9, 2024, 6:39 PM
+ */
+
+#ifndef ECU_RELAY_CFG_H
+#define	ECU_RELAY_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+
+#endif	/* ECU_RELAY_CFG_H */
+
@@ -0,0 +1,239 @@
+/*
+ * File:   ecu_scheduler.c
+ */
+
+#include "ecu_scheduler.h"
+
+/*
+ * Time base: the soft timer tick(Timer0), soft_timer_initialize has to run first.
+ * Dispatch : every released task runs to completion in table order(cooperative),
+ *            a late task runs once for its newest release and the skipped releases
+ *            are counted as overruns, so a slow task never runs in a burst.
+ * Idle     : with nothing released the CPU idles(IDLEN = 1: SLEEP stops only the CPU,
+ *            Timer0 keeps counting) until the next interrupt.
+ */
+
+typedef struct{
+    uint32 release_tick;
+    uint16 deadline_ticks;
+}scheduler_task_state_t;
+
+static const scheduler_task_t *scheduler_tasks = NULL;
+static uint8 scheduler_task_count = 0;
+static scheduler_task_state_t scheduler_states[SCHEDULER_CFG_MAX_TASKS];
+static scheduler_task_stats_t scheduler_stats[SCHEDULER_CFG_MAX_TASKS];
+
+static void scheduler_run_task(uint8 task_index , uint32 now);
+
+/**
+ * @brief check the task table and set the first release of every task at its offset.
+ * @param tasks the static task table.
+ * @param task_count entries of the table(1..SCHEDULER_CFG_MAX_TASKS).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means an entry has no function, a period of 0 or a deadline over its period.
+ */
+Std_ReturnType scheduler_initialize(const scheduler_task_t *tasks , uint8 task_count)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_task_index = 0;
+    uint32 l_now = 0;
+    if((NULL == tasks) || (0 == task_count) || (task_count > SCHEDULER_CFG_MAX_TASKS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        scheduler_tasks = NULL;
+        for(l_task_index = 0 ; (l_task_index < task_count) && (E_OK == ret) ; l_task_index++)
+        {
+            if((NULL == tasks[l_task_index].task) || (0 == tasks[l_task_index].period_ticks) ||
+               (tasks[l_task_index].deadline_ticks > tasks[l_task_index].period_ticks))
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        if(E_OK == ret)
+        {
+            ret = soft_timer_get_ticks(&l_now);
+            for(l_task_index = 0 ; l_task_index < task_count ; l_task_index++)
+            {
+                scheduler_states[l_task_index].release_tick = l_now + tasks[l_task_index].offset_ticks;
+                scheduler_states[l_task_index].deadline_ticks = tasks[l_task_index].deadline_ticks;
+                if(0 == scheduler_states[l_task_index].deadline_ticks)
+                {
+                    scheduler_states[l_task_index].deadline_ticks = tasks[l_task_index].period_ticks;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            scheduler_task_count = task_count;
+            scheduler_tasks = tasks;
+            ret = scheduler_reset_stats();
+#if SCHEDULER_CFG_IDLE_SLEEP == SCHEDULER_CFG_FEATURE_ENABLE
+            OSCCONbits.IDLEN = 1;
+#endif
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief run every released task once, then idle until the next interrupt when
+ *        nothing was released. Called from the application while(1).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the scheduler is not initialized.
+ */
+Std_ReturnType scheduler_dispatch(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_task_index = 0;
+    uint8 l_released = 0;
+    uint32 l_now = 0;
+#if SCHEDULER_CFG_IDLE_SLEEP == SCHEDULER_CFG_FEATURE_ENABLE
+    uint32 l_ticks = 0;
+    uint8 l_gie_status = 0;
+#endif
+    if(NULL == scheduler_tasks)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = soft_timer_get_ticks(&l_now);
+        for(l_task_index = 0 ; l_task_index < scheduler_task_count ; l_task_index++)
+        {
+            if((sint32)(l_now - scheduler_states[l_task_index].release_tick) >= 0)
+            {
+                scheduler_run_task(l_task_index , l_now);
+                l_released = 1;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+#if SCHEDULER_CFG_IDLE_SLEEP == SCHEDULER_CFG_FEATURE_ENABLE
+        if(0 == l_released)
+        {
+            /*A tick between the check and SLEEP leaves TMR0IF set, SLEEP then wakes at once*/
+            l_gie_status = INTCONbits.GIE;
+            INTCONbits.GIE = 0;
+            ret = soft_timer_get_ticks(&l_ticks);
+            if(l_ticks == l_now)
+            {
+                SLEEP();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            INTCONbits.GIE = l_gie_status;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+    }
+    return ret;
+}
+
+/**
+ * @brief get the execution time and the counters of a task.
+ * @param task_index the entry in the task table.
+ * @param stats pointer to store the statistics.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType scheduler_get_task_stats(uint8 task_index , scheduler_task_stats_t *stats)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == stats) || (task_index >= scheduler_task_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *stats = scheduler_stats[task_index];
+    }
+    return ret;
+}
+
+/**
+ * @brief clear the execution times and the counters of every task.
+ * @return E_OK always.
+ */
+Std_ReturnType scheduler_reset_stats(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_task_index = 0;
+    for(l_task_index = 0 ; l_task_index < SCHEDULER_CFG_MAX_TASKS ; l_task_index++)
+    {
+        scheduler_stats[l_task_index].exec_time_last = 0;
+        scheduler_stats[l_task_index].exec_time_max = 0;
+        scheduler_stats[l_task_index].run_count = 0;
+        scheduler_stats[l_task_index].overrun_count = 0;
+        scheduler_stats[l_task_index].deadline_miss_count = 0;
+    }
+    return ret;
+}
+
+/*Run a released task, measure it and set its next release*/
+static void scheduler_run_task(uint8 task_index , uint32 now)
+{
+    const scheduler_task_t *l_task = &scheduler_tasks[task_index];
+    scheduler_task_state_t *l_state = &scheduler_states[task_index];
+    scheduler_task_stats_t *l_stats = &scheduler_stats[task_index];
+    uint32 l_late_ticks = now - l_state -> release_tick;
+    uint32 l_skipped = 0;
+    uint32 l_start = 0;
+    uint32 l_end = 0;
+    uint32 l_finish_tick = 0;
+    if(l_late_ticks >= l_task -> period_ticks)
+    {
+        /*Run for the newest release only*/
+        l_skipped = l_late_ticks / l_task -> period_ticks;
+        l_stats -> overrun_count += (uint16)l_skipped;
+        l_state -> release_tick += l_skipped * l_task -> period_ticks;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    soft_timer_get_timestamp(&l_start);
+    l_task -> task();
+    soft_timer_get_timestamp(&l_end);
+    soft_timer_get_ticks(&l_finish_tick);
+    l_stats -> exec_time_last = l_end - l_start;
+    if(l_stats -> exec_time_last > l_stats -> exec_time_max)
+    {
+        l_stats -> exec_time_max = l_stats -> exec_time_last;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    l_stats -> run_count++;
+    if((l_finish_tick - l_state -> release_tick) >= l_state -> deadline_ticks)
+    {
+        l_stats -> deadline_miss_count++;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    l_state -> release_tick += l_task -> period_ticks;
+}
@@ -0,0 +1,43 @@
+/*
+ * File:   ecu_scheduler.h
+ */
+
+#ifndef ECU_SCHEDULER_H
+#define	ECU_SCHEDULER_H
+
+/******************Section: Includes**********************/
+#include "ecu_scheduler_cfg.h"
+#include "../Soft_Timer/ecu_soft_timer.h"
+
+/******************Section: Macros Declarations***********/
+#if (SCHEDULER_CFG_MAX_TASKS == 0U) || (SCHEDULER_CFG_MAX_TASKS > 255U)
+#error "SCHEDULER_CFG_MAX_TASKS must be 1 - 255"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+/*Task table times are in soft timer ticks(SOFT_TIMER_CFG_TICK_MS each)*/
+#define SCHEDULER_MS_TO_TICKS(_MS)      ((uint16)((_MS) / SOFT_TIMER_CFG_TICK_MS))
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+    void(*task)(void);
+    uint16 period_ticks;       /*Release period, at least 1*/
+    uint16 offset_ticks;       /*First release after scheduler_initialize, spreads the tasks over the ticks*/
+    uint16 deadline_ticks;     /*Completion limit after the release, 0: the period*/
+}scheduler_task_t;
+
+typedef struct{
+    uint32 exec_time_last;     /*Timer0 counts(SOFT_TIMER_TIMESTAMP_PER_MS per ms), interrupts included*/
+    uint32 exec_time_max;
+    uint16 run_count;          /*The counters wrap*/
+    uint16 overrun_count;      /*Releases skipped, the task started a period or more late*/
+    uint16 deadline_miss_count;
+}scheduler_task_stats_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType scheduler_initialize(const scheduler_task_t *tasks , uint8 task_count);
+Std_ReturnType scheduler_dispatch(void);
+Std_ReturnType scheduler_get_task_stats(uint8 task_index , scheduler_task_stats_t *stats);
+Std_ReturnType scheduler_reset_stats(void);
+
+#endif	/* ECU_SCHEDULER_H */
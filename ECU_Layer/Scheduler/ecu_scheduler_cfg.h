@@ -0,0 +1,26 @@
+/*
+ * File:   ecu_scheduler_cfg.h
+ */
+
+#ifndef ECU_SCHEDULER_CFG_H
+#define	ECU_SCHEDULER_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define SCHEDULER_CFG_FEATURE_ENABLE    1
+#define SCHEDULER_CFG_FEATURE_DISABLE   0
+
+/*Entries of the task table, the table order is the dispatch order*/
+#define SCHEDULER_CFG_MAX_TASKS         8U
+
+/*Idle mode(IDLEN + SLEEP) between ticks, the peripherals keep running*/
+#define SCHEDULER_CFG_IDLE_SLEEP        SCHEDULER_CFG_FEATURE_ENABLE
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_SCHEDULER_CFG_H */
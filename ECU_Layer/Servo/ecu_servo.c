@@ -0,0 +1,358 @@
+/*
+ * File:   ecu_servo.c
+ */
+
+#include "ecu_servo.h"
+
+/*
+ * Frame   : the enabled channels are pulsed one after another from the frame start, the
+ *           falling edge of a channel and the rising edge of the next one share one
+ *           compare interrupt, then the rest of the frame is waited in gap steps.
+ * Timing  : every compare value is the previous one + the step(never the timer value),
+ *           the interrupt latency delays the edges but never accumulates.
+ * Update  : servo_update builds the next schedule in the shadow buffer,
+ *           the ISR switches to it at the next frame start.
+ */
+
+#define SERVO_STATE_PULSE            0x00U
+#define SERVO_STATE_GAP              0x01U
+
+/*Longest gap step, the last step of a gap is never shorter than half of it*/
+#define SERVO_GAP_STEP_TICKS         0x8000UL
+/*First compare after servo_initialize*/
+#define SERVO_START_DELAY_TICKS      0x1000U
+
+typedef struct{
+    uint16 width_ticks[SERVO_CFG_MAX_CHANNELS];    /*Per slot*/
+    uint8 channel[SERVO_CFG_MAX_CHANNELS];         /*Channel pulsed in the slot*/
+    uint8 slots;                                   /*Enabled channels*/
+}servo_schedule_t;
+
+static const servo_t *servo_obj = NULL;
+static ccp_t servo_ccp;
+static timer1_t servo_timer1;
+static timer3_t servo_timer3;
+
+static uint16 servo_width_ticks[SERVO_CFG_MAX_CHANNELS];    /*Per channel, 0: disabled*/
+static servo_schedule_t servo_schedules[2];                  /*Active one + shadow*/
+static volatile uint8 servo_active = 0;
+static volatile uint8 servo_update_pending = 0;
+
+/*Compare ISR state*/
+static uint16 servo_compare_value = 0;
+static uint8 servo_state = SERVO_STATE_GAP;
+static uint8 servo_slot = 0;
+static uint32 servo_frame_left = 0;
+
+static void servo_compare_isr(void);
+
+/**
+ * @brief initialize the channel pins(low), the compare timer(Fosc/4, free running)
+ *        and the CCP in compare mode, all channels start disabled.
+ * @param servo pointer points to servo_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType servo_initialize(const servo_t *servo)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_channel = 0;
+    uint8 l_timer3 = 0;
+    uint16 l_timer_value = 0;
+    if((NULL == servo) || (servo -> ccp_inst > CCP2_INST) || (servo -> ccp_timer > CCP1_CCP2_TIMER1) ||
+       (0 == servo -> channel_count) || (servo -> channel_count > SERVO_CFG_MAX_CHANNELS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        servo_obj = NULL;
+        for(l_channel = 0 ; (l_channel < servo -> channel_count) && (E_OK == ret) ; l_channel++)
+        {
+            ret = gpio_pin_intialize(&(servo -> channels[l_channel]));
+            if(E_OK == ret)
+            {
+                ret = gpio_pin_write_logic(&(servo -> channels[l_channel]) , GPIO_LOW);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            servo_width_ticks[l_channel] = 0;
+        }
+        /*T3CCP2:T3CCP1 selects the compare timer of each CCP,
+          the CCP pin isn't driven in the software interrupt mode, it's kept a low output*/
+        if(CCP1_INST == servo -> ccp_inst)
+        {
+            l_timer3 = (CCP1_CCP2_TIMER3 == servo -> ccp_timer);
+            servo_ccp.pin_init.pin = GPIO_PIN2;
+        }
+        else
+        {
+            l_timer3 = (CCP1_CCP2_TIMER1 != servo -> ccp_timer);
+            servo_ccp.pin_init.pin = GPIO_PIN1;
+        }
+        if(E_OK == ret)
+        {
+            servo_schedules[0].slots = 0;
+            servo_schedules[1].slots = 0;
+            servo_active = 0;
+            servo_update_pending = 0;
+            servo_state = SERVO_STATE_GAP;
+            servo_frame_left = 0;
+            if(l_timer3)
+            {
+                servo_timer3.prescaler_value = TIMER3_PRESCALER_DIV_BY_1;
+                servo_timer3.timer3_mode = TIMER3_TIMER_MODE;
+                servo_timer3.timer3_counter_mode = TIMER3_SYNC_COUNTER_MODE;
+                servo_timer3.timer3_reg_wr_mode = TIMER3_RW_REGESTER_16BIT_MODE;
+                servo_timer3.timer3_preload_value = 0;
+                ret = Timer3_Init(&servo_timer3);
+                if(E_OK == ret)
+                {
+                    ret = Timer3_Read_Value(&servo_timer3 , &l_timer_value);
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            else
+            {
+                servo_timer1.prescaler_value = TIMER1_PRESCALER_DIV_BY_1;
+                servo_timer1.timer1_mode = TIMER1_TIMER_MODE;
+                servo_timer1.timer1_counter_mode = TIMER1_SYNC_COUNTER_MODE;
+                servo_timer1.timer1_osc_cfg = TIMER1_OSC_DISABLE;
+                servo_timer1.timer1_reg_wr_mode = TIMER1_RW_REGESTER_16BIT_MODE;
+                servo_timer1.timer1_preload_value = 0;
+                ret = Timer1_Init(&servo_timer1);
+                if(E_OK == ret)
+                {
+                    ret = Timer1_Read_Value(&servo_timer1 , &l_timer_value);
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            servo_ccp.CCP_InterruptHandler = servo_compare_isr;
+            servo_ccp.priority = SERVO_CFG_PRIORITY;
+            servo_ccp.ccp_inst = servo -> ccp_inst;
+            servo_ccp.CCP_mode = CCP_COMPARE_MODE_SELECT;
+            servo_ccp.CCP_mode_variant = CCP_COMPARE_MODE_GEN_SW_INTERRUPT;
+            servo_ccp.ccp_capture_timer = servo -> ccp_timer;
+            servo_ccp.pin_init.port = PORTC_INDEX;
+            servo_ccp.pin_init.direction = GPIO_DIRECTION_OUTPUT;
+            servo_ccp.pin_init.logic = GPIO_LOW;
+            /*First match written before the compare mode is enabled*/
+            servo_compare_value = l_timer_value + SERVO_START_DELAY_TICKS;
+            servo_obj = servo;
+            if(E_OK == ret)
+            {
+                ret = CCP_CompareModeSetValue(&servo_ccp , servo_compare_value);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(E_OK == ret)
+            {
+                ret = CCP_Init(&servo_ccp);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief set the pulse width of a channel in microseconds,
+ *        takes effect after servo_update.
+ * @param channel 0..channel_count - 1.
+ * @param pulse_us SERVO_CFG_MIN_PULSE_US..SERVO_CFG_MAX_PULSE_US.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType servo_set_pulse_us(uint8 channel , uint16 pulse_us)
+{
+    Std_ReturnType ret = E_OK;
+    if((pulse_us < SERVO_CFG_MIN_PULSE_US) || (pulse_us > SERVO_CFG_MAX_PULSE_US))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = servo_set_pulse_ticks(channel , (uint16)(pulse_us * SERVO_TICKS_PER_US));
+    }
+    return ret;
+}
+
+/**
+ * @brief set the pulse width of a channel in timer ticks(4 / Fosc each, the finest step),
+ *        takes effect after servo_update.
+ * @param channel 0..channel_count - 1.
+ * @param pulse_ticks the pulse range of SERVO_CFG_MIN/MAX_PULSE_US in ticks.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType servo_set_pulse_ticks(uint8 channel , uint16 pulse_ticks)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == servo_obj) || (channel >= servo_obj -> channel_count) ||
+       (pulse_ticks < (SERVO_CFG_MIN_PULSE_US * SERVO_TICKS_PER_US)) ||
+       (pulse_ticks > (SERVO_CFG_MAX_PULSE_US * SERVO_TICKS_PER_US)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        servo_width_ticks[channel] = pulse_ticks;
+    }
+    return ret;
+}
+
+/**
+ * @brief stop the pulses of a channel(its pin stays low), takes effect after servo_update.
+ * @param channel 0..channel_count - 1.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType servo_disable(uint8 channel)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == servo_obj) || (channel >= servo_obj -> channel_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        servo_width_ticks[channel] = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief build the schedule of the enabled channels in the shadow buffer,
+ *        all the channels change together at the next frame start.
+ *        A second update before that frame replaces the first one.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the driver is not initialized.
+ */
+Std_ReturnType servo_update(void)
+{
+    Std_ReturnType ret = E_OK;
+    servo_schedule_t *l_shadow = NULL;
+    uint8 l_channel = 0;
+    if(NULL == servo_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*The ISR doesn't switch while the shadow is rewritten*/
+        servo_update_pending = 0;
+        l_shadow = &servo_schedules[servo_active ^ 1U];
+        l_shadow -> slots = 0;
+        for(l_channel = 0 ; l_channel < servo_obj -> channel_count ; l_channel++)
+        {
+            if(0 != servo_width_ticks[l_channel])
+            {
+                l_shadow -> channel[l_shadow -> slots] = l_channel;
+                l_shadow -> width_ticks[l_shadow -> slots] = servo_width_ticks[l_channel];
+                l_shadow -> slots++;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        servo_update_pending = 1;
+    }
+    return ret;
+}
+
+/**
+ * @brief check if the last servo_update is still waiting for the frame start.
+ * @param pending pointer to store 1(waiting) or 0(applied).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType servo_is_update_pending(uint8 *pending)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == pending)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *pending = servo_update_pending;
+    }
+    return ret;
+}
+
+/*CCP compare handler: ends the running pulse, starts the next one or waits a gap step*/
+static void servo_compare_isr(void)
+{
+    const servo_schedule_t *l_schedule = &servo_schedules[servo_active];
+    uint16 l_step = 0;
+    if(SERVO_STATE_PULSE == servo_state)
+    {
+        gpio_pin_write_logic(&(servo_obj -> channels[l_schedule -> channel[servo_slot]]) , GPIO_LOW);
+        servo_slot++;
+    }
+    else if(0 == servo_frame_left)
+    {
+        /*Frame start*/
+        if(servo_update_pending)
+        {
+            servo_active ^= 1U;
+            servo_update_pending = 0;
+            l_schedule = &servo_schedules[servo_active];
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        servo_slot = 0;
+        servo_frame_left = SERVO_FRAME_TICKS;
+        servo_state = SERVO_STATE_PULSE;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if((SERVO_STATE_PULSE == servo_state) && (servo_slot < l_schedule -> slots))
+    {
+        gpio_pin_write_logic(&(servo_obj -> channels[l_schedule -> channel[servo_slot]]) , GPIO_HIGH);
+        l_step = l_schedule -> width_ticks[servo_slot];
+    }
+    else
+    {
+        servo_state = SERVO_STATE_GAP;
+        if(servo_frame_left > (SERVO_GAP_STEP_TICKS + (SERVO_GAP_STEP_TICKS / 2UL)))
+        {
+            l_step = (uint16)SERVO_GAP_STEP_TICKS;
+        }
+        else
+        {
+            l_step = (uint16)servo_frame_left;
+        }
+    }
+    servo_frame_left -= l_step;
+    servo_compare_value += l_step;
+    CCP_CompareModeSetValue(&servo_ccp , servo_compare_value);
+}
@@ -0,0 +1,54 @@
+/*
+ * File:   ecu_servo.h
+ */
+
+#ifndef ECU_SERVO_H
+#define	ECU_SERVO_H
+
+/******************Section: Includes**********************/
+#include "ecu_servo_cfg.h"
+#include "../../MCAL_Layer/CCP1/hal_ccp1.h"
+
+/******************Section: Macros Declarations***********/
+/*The compare timer runs at Fosc / 4 without a prescaler: one tick per instruction cycle*/
+#define SERVO_TICKS_PER_US           ((_XTAL_FREQ / 4UL) / 1000000UL)
+#define SERVO_FRAME_TICKS            (SERVO_CFG_FRAME_US * SERVO_TICKS_PER_US)
+
+#if ((_XTAL_FREQ / 4UL) % 1000000UL) != 0UL
+#error "The servo timing needs _XTAL_FREQ to be a multiple of 4 MHz"
+#endif
+
+#if (CCP1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE) || \
+    (CCP2_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "The servo pulses are chained from the CCP compare interrupt"
+#endif
+
+#if (SERVO_CFG_MAX_CHANNELS == 0U) || \
+    ((SERVO_CFG_MAX_CHANNELS * SERVO_CFG_MAX_PULSE_US) >= SERVO_CFG_FRAME_US)
+#error "SERVO_CFG_MAX_CHANNELS pulses of SERVO_CFG_MAX_PULSE_US must fit SERVO_CFG_FRAME_US"
+#endif
+
+#if (SERVO_CFG_MIN_PULSE_US > SERVO_CFG_MAX_PULSE_US) || \
+    ((SERVO_CFG_MAX_PULSE_US * SERVO_TICKS_PER_US) > 0xFFFFUL)
+#error "SERVO_CFG_MAX_PULSE_US must be at least SERVO_CFG_MIN_PULSE_US and fit 16-bit timer ticks"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+    ccp_inst ccp_inst;                                /*Compare unit(CCP1_INST or CCP2_INST)*/
+    ccp_capture_timer ccp_timer;                      /*Timer1/Timer3 selection, shared with the other CCP*/
+    uint8 channel_count;                              /*1..SERVO_CFG_MAX_CHANNELS*/
+    pin_config_t channels[SERVO_CFG_MAX_CHANNELS];    /*Any GPIO, driven high during the pulse*/
+}servo_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType servo_initialize(const servo_t *servo);
+Std_ReturnType servo_set_pulse_us(uint8 channel , uint16 pulse_us);
+Std_ReturnType servo_set_pulse_ticks(uint8 channel , uint16 pulse_ticks);
+Std_ReturnType servo_disable(uint8 channel);
+Std_ReturnType servo_update(void);
+Std_ReturnType servo_is_update_pending(uint8 *pending);
+
+#endif	/* ECU_SERVO_H */
@@ -0,0 +1,30 @@
+/*
+ * File:   ecu_servo_cfg.h
+ */
+
+#ifndef ECU_SERVO_CFG_H
+#define	ECU_SERVO_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Servo outputs driven from one CCP compare unit*/
+#define SERVO_CFG_MAX_CHANNELS       8U
+
+/*Frame period, every enabled channel gets one pulse per frame*/
+#define SERVO_CFG_FRAME_US           20000UL
+
+/*Accepted pulse range, all channels at the maximum must fit one frame*/
+#define SERVO_CFG_MIN_PULSE_US       1000U
+#define SERVO_CFG_MAX_PULSE_US       2000U
+
+/*Priority of the compare interrupt, edge jitter is the latency of this interrupt*/
+#define SERVO_CFG_PRIORITY           INTERRUPT_HIGH_PRIORITY
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_SERVO_CFG_H */
@@ -0,0 +1,701 @@
+/*
+ * File:   ecu_shell.c
+ */
+
+#include "ecu_shell.h"
+
+/*
+ * Input  : shell_process(main loop) takes at most SHELL_CFG_BYTES_PER_CALL bytes
+ *          from the EUSART RX ring buffer and edits the line, nothing waits for input.
+ * Output : everything goes through the sink of shell_t.
+ * Listing: help and the dumps print one line per shell_process call, input is held
+ *          meanwhile, so a blocking sink never sends more than a line per call.
+ */
+
+#define SHELL_DUMP_NONE                  0x00U
+#define SHELL_DUMP_DATA_MEMORY           0x01U
+#define SHELL_DUMP_EEPROM                0x02U
+#define SHELL_DUMP_HELP                  0x03U
+
+/*Data memory addresses are 12-bit, go through an integer as wide as a pointer*/
+#define SHELL_DATA_MEMORY_BYTE(_ADDRESS) (*((volatile uint8 *)(uintptr_t)(_ADDRESS)))
+
+#define SHELL_CHAR_BELL                  0x07U
+#define SHELL_CHAR_BACKSPACE             0x08U
+#define SHELL_CHAR_DELETE                0x7FU
+#define SHELL_CHAR_KILL_LINE             0x15U   /*Ctrl-U*/
+
+typedef struct{
+    const char *name;
+    volatile uint8 *control;
+    uint8 enable_mask;
+}shell_peripheral_t;
+
+static void shell_cmd_help(uint8 argc , char *argv[]);
+static void shell_cmd_peek(uint8 argc , char *argv[]);
+static void shell_cmd_poke(uint8 argc , char *argv[]);
+static void shell_cmd_eeprom(uint8 argc , char *argv[]);
+static void shell_cmd_stats(uint8 argc , char *argv[]);
+static void shell_cmd_isr(uint8 argc , char *argv[]);
+static void shell_cmd_start(uint8 argc , char *argv[]);
+static void shell_cmd_stop(uint8 argc , char *argv[]);
+
+/*Kept in program memory*/
+static const shell_command_t shell_commands[] = {
+    {"help"  , "                 list the commands"                  , shell_cmd_help},
+    {"peek"  , "<addr> [count]   dump data memory(RAM and SFRs)"     , shell_cmd_peek},
+    {"poke"  , "<addr> <value>   write a data memory byte"           , shell_cmd_poke},
+    {"ee"    , "<addr> [count]   dump the data EEPROM"               , shell_cmd_eeprom},
+    {"stats" , "                 show the driver statistics"         , shell_cmd_stats},
+    {"isr"   , "[clear]          show or clear the ISR counters"     , shell_cmd_isr},
+    {"start" , "<peripheral>     turn a peripheral on"               , shell_cmd_start},
+    {"stop"  , "<peripheral>     turn a peripheral off"              , shell_cmd_stop},
+};
+
+static const shell_peripheral_t shell_peripherals[] = {
+    {"tmr0" , &T0CON   , 0x80},   /*TMR0ON*/
+    {"tmr1" , &T1CON   , 0x01},   /*TMR1ON*/
+    {"tmr2" , &T2CON   , 0x04},   /*TMR2ON*/
+    {"tmr3" , &T3CON   , 0x01},   /*TMR3ON*/
+    {"adc"  , &ADCON0  , 0x01},   /*ADON*/
+    {"mssp" , &SSPCON1 , 0x20},   /*SSPEN*/
+};
+
+#if INTERRUPT_COUNTERS_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/*Same order as interrupt_source_t*/
+static const char * const shell_isr_names[INTERRUPT_SOURCE_COUNT] = {
+    "int0" , "int1" , "int2" , "rb" , "adc" , "eusart_rx" , "eusart_tx" , "tmr3" ,
+    "mssp" , "bus_col" , "ccp1" , "ccp2" , "tmr2" , "tmr1" , "tmr0"
+};
+#endif
+
+static const shell_t *shell_obj = NULL;
+static char shell_line[SHELL_CFG_LINE_SIZE];
+static uint8 shell_line_length = 0;
+static uint8 shell_last_char = 0;
+static uint8 shell_dump_kind = SHELL_DUMP_NONE;
+static uint16 shell_dump_address = 0;
+static uint16 shell_dump_remaining = 0;
+
+static void shell_execute(void);
+static void shell_dump_line(void);
+static void shell_help_line(void);
+static Std_ReturnType shell_dump_start(uint8 kind , uint8 argc , char *argv[] , uint16 memory_size);
+static uint8 shell_string_equal(const char *first , const char *second);
+static const shell_peripheral_t *shell_find_peripheral(const char *name);
+
+/**
+ * @brief start the shell and print the prompt.
+ * @param shell pointer points to shell_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType shell_initialize(const shell_t *shell)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == shell) || (NULL == shell -> output) ||
+       ((NULL == shell -> user_commands) && (0 != shell -> user_command_count)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        shell_obj = shell;
+        shell_line_length = 0;
+        shell_last_char = 0;
+        shell_dump_kind = SHELL_DUMP_NONE;
+        ret = shell_print("\r\n" SHELL_CFG_PROMPT);
+    }
+    return ret;
+}
+
+/**
+ * @brief run the shell for a bounded time: continue a dump or handle the
+ *        received bytes. must be called periodically from the main loop.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the shell is not initialized.
+ */
+Std_ReturnType shell_process(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_budget = SHELL_CFG_BYTES_PER_CALL;
+    uint8 l_data = 0;
+    uint16 l_read_count = 1;
+    if(NULL == shell_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(SHELL_DUMP_HELP == shell_dump_kind)
+    {
+        shell_help_line();
+    }
+    else if(SHELL_DUMP_NONE != shell_dump_kind)
+    {
+        shell_dump_line();
+    }
+    else
+    {
+        while((l_budget > 0) && (1 == l_read_count) && (SHELL_DUMP_NONE == shell_dump_kind))
+        {
+            ret = EUSART_ASYNCH_RX_Read(&l_data , 1 , &l_read_count);
+            if(1 == l_read_count)
+            {
+                ret = shell_receive_byte(l_data);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            l_budget--;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief feed one input character to the line editor.
+ *        supports backspace/delete, Ctrl-U(kill line) and CR, LF or CR LF endings.
+ * @param data the received character.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the shell is not initialized.
+ */
+Std_ReturnType shell_receive_byte(uint8 data)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == shell_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(('\r' == data) || ('\n' == data))
+    {
+        if(('\n' == data) && ('\r' == shell_last_char))
+        {
+            /*Second half of CR LF*/
+        }
+        else
+        {
+            ret = shell_print("\r\n");
+            if(shell_line_length > 0)
+            {
+                shell_line[shell_line_length] = '\0';
+                shell_execute();
+                shell_line_length = 0;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(SHELL_DUMP_NONE == shell_dump_kind)
+            {
+                ret = shell_print(SHELL_CFG_PROMPT);
+            }
+            else
+            {
+                /*The prompt follows the last dump line*/
+            }
+        }
+    }
+    else if((SHELL_CHAR_BACKSPACE == data) || (SHELL_CHAR_DELETE == data))
+    {
+        if(shell_line_length > 0)
+        {
+            shell_line_length--;
+            ret = shell_print("\b \b");
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else if(SHELL_CHAR_KILL_LINE == data)
+    {
+        while(shell_line_length > 0)
+        {
+            shell_line_length--;
+            ret = shell_print("\b \b");
+        }
+    }
+    else if((data >= ' ') && (data <= '~'))
+    {
+        if(shell_line_length < (SHELL_CFG_LINE_SIZE - 1))
+        {
+            shell_line[shell_line_length] = (char)data;
+            shell_line_length++;
+            shell_obj -> output(shell_obj -> output_context , data);
+        }
+        else
+        {
+            shell_obj -> output(shell_obj -> output_context , SHELL_CHAR_BELL);
+        }
+    }
+    else
+    {
+        /*Other control characters are ignored*/
+    }
+    shell_last_char = data;
+    return ret;
+}
+
+/**
+ * @brief formatted output to the shell sink(see std_format), for application commands.
+ * @param format the format string.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType shell_print(const char *format , ...)
+{
+    Std_ReturnType ret = E_OK;
+    va_list args;
+    if(NULL == shell_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        va_start(args , format);
+        ret = std_vformat(shell_obj -> output , shell_obj -> output_context , format , args);
+        va_end(args);
+    }
+    return ret;
+}
+
+/**
+ * @brief parse a decimal or 0x prefixed hexadecimal argument.
+ * @param str the argument.
+ * @param value pointer to store the value(max 0xFFFF).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the argument is not a valid number.
+ */
+Std_ReturnType shell_parse_number(const char *str , uint16 *value)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_value = 0;
+    uint8 l_base = 10;
+    uint8 l_digit = 0;
+    if((NULL == str) || (NULL == value) || ('\0' == *str))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(('0' == str[0]) && (('x' == str[1]) || ('X' == str[1])) && ('\0' != str[2]))
+        {
+            l_base = 16;
+            str += 2;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        while((E_OK == ret) && ('\0' != *str))
+        {
+            if((*str >= '0') && (*str <= '9'))
+            {
+                l_digit = (uint8)(*str - '0');
+            }
+            else if((*str >= 'a') && (*str <= 'f'))
+            {
+                l_digit = (uint8)(*str - 'a' + 10);
+            }
+            else if((*str >= 'A') && (*str <= 'F'))
+            {
+                l_digit = (uint8)(*str - 'A' + 10);
+            }
+            else
+            {
+                l_digit = 0xFF;
+            }
+            if(l_digit >= l_base)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                l_value = (l_value * l_base) + l_digit;
+                if(l_value > 0xFFFFUL)
+                {
+                    ret = E_NOT_OK;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+            }
+            str++;
+        }
+        if(E_OK == ret)
+        {
+            *value = (uint16)l_value;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief split the line in place and run the matching command.
+ */
+static void shell_execute(void)
+{
+    char *l_argv[SHELL_CFG_MAX_ARGS];
+    uint8 l_argc = 0;
+    uint8 l_index = 0;
+    uint8 l_counter = 0;
+    uint8 l_too_many = 0;
+    const shell_command_t *l_command = NULL;
+    while('\0' != shell_line[l_index])
+    {
+        if(' ' == shell_line[l_index])
+        {
+            shell_line[l_index] = '\0';
+        }
+        else if((0 == l_index) || ('\0' == shell_line[l_index - 1]))
+        {
+            if(l_argc < SHELL_CFG_MAX_ARGS)
+            {
+                l_argv[l_argc] = &shell_line[l_index];
+                l_argc++;
+            }
+            else
+            {
+                l_too_many = 1;
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        l_index++;
+    }
+    if(0 == l_argc)
+    {
+        /*Only spaces*/
+    }
+    else if(l_too_many)
+    {
+        shell_print("error: too many arguments\r\n");
+    }
+    else
+    {
+        for(l_counter = 0 ; (l_counter < (sizeof(shell_commands) / sizeof(shell_command_t))) &&
+                            (NULL == l_command) ; l_counter++)
+        {
+            if(shell_string_equal(l_argv[0] , shell_commands[l_counter].name))
+            {
+                l_command = &shell_commands[l_counter];
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        for(l_counter = 0 ; (l_counter < shell_obj -> user_command_count) && (NULL == l_command) ; l_counter++)
+        {
+            if(shell_string_equal(l_argv[0] , shell_obj -> user_commands[l_counter].name))
+            {
+                l_command = &(shell_obj -> user_commands[l_counter]);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        if(NULL == l_command)
+        {
+            shell_print("error: unknown command '%s', try help\r\n" , l_argv[0]);
+        }
+        else
+        {
+            l_command -> handler(l_argc , l_argv);
+        }
+    }
+}
+
+static void shell_cmd_help(uint8 argc , char *argv[])
+{
+    (void)argc;
+    (void)argv;
+    /*One line per command, then the peripherals line*/
+    shell_dump_address = 0;
+    shell_dump_remaining = (uint16)((sizeof(shell_commands) / sizeof(shell_command_t)) +
+                                    shell_obj -> user_command_count + 1U);
+    shell_dump_kind = SHELL_DUMP_HELP;
+}
+
+static void shell_cmd_peek(uint8 argc , char *argv[])
+{
+    if(E_NOT_OK == shell_dump_start(SHELL_DUMP_DATA_MEMORY , argc , argv , SHELL_CFG_DATA_MEMORY_SIZE))
+    {
+        shell_print("error: usage peek <addr> [count], addr < 0x%X\r\n" , SHELL_CFG_DATA_MEMORY_SIZE);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void shell_cmd_poke(uint8 argc , char *argv[])
+{
+    uint16 l_address = 0;
+    uint16 l_value = 0;
+    if((3 != argc) || (E_NOT_OK == shell_parse_number(argv[1] , &l_address)) ||
+       (E_NOT_OK == shell_parse_number(argv[2] , &l_value)) ||
+       (l_address >= SHELL_CFG_DATA_MEMORY_SIZE) || (l_value > 0xFF))
+    {
+        shell_print("error: usage poke <addr> <value>, value <= 0xFF\r\n");
+    }
+    else
+    {
+        SHELL_DATA_MEMORY_BYTE(l_address) = (uint8)l_value;
+        shell_print("%04X: %02X\r\n" , l_address , SHELL_DATA_MEMORY_BYTE(l_address));
+    }
+}
+
+static void shell_cmd_eeprom(uint8 argc , char *argv[])
+{
+    if(E_NOT_OK == shell_dump_start(SHELL_DUMP_EEPROM , argc , argv , SHELL_CFG_EEPROM_SIZE))
+    {
+        shell_print("error: usage ee <addr> [count], addr < 0x%X\r\n" , SHELL_CFG_EEPROM_SIZE);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void shell_cmd_stats(uint8 argc , char *argv[])
+{
+    usart_rx_statistics_t l_rx_statistics;
+    uint32 l_baudrate = 0;
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+    uint8 l_overflows = 0;
+#endif
+    (void)argc;
+    (void)argv;
+    EUSART_ASYNCH_GetBaudrate(&l_baudrate);
+    EUSART_ASYNCH_RX_GetStatistics(&l_rx_statistics);
+    shell_print("eusart: %lu baud, framing %u, overrun %u, rx buffer full %u\r\n" , l_baudrate ,
+                l_rx_statistics.framing_errors , l_rx_statistics.overrun_errors ,
+                l_rx_statistics.buffer_overflows);
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+    EUSART_ASYNCH_AutoBaud_GetOverflowCount(&l_overflows);
+    shell_print("eusart: auto-baud overflows %u\r\n" , l_overflows);
+#endif
+}
+
+static void shell_cmd_isr(uint8 argc , char *argv[])
+{
+#if INTERRUPT_COUNTERS_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    uint16 l_count = 0;
+    uint8 l_counter = 0;
+    if((2 == argc) && (shell_string_equal(argv[1] , "clear")))
+    {
+        Interrupt_ClearCounts();
+    }
+    else if(1 == argc)
+    {
+        for(l_counter = 0 ; l_counter < INTERRUPT_SOURCE_COUNT ; l_counter++)
+        {
+            Interrupt_GetCount((interrupt_source_t)l_counter , &l_count);
+            shell_print("%-10s %u\r\n" , shell_isr_names[l_counter] , l_count);
+        }
+    }
+    else
+    {
+        shell_print("error: usage isr [clear]\r\n");
+    }
+#else
+    shell_print("error: INTERRUPT_COUNTERS_FEATURE_ENABLE is off\r\n");
+#endif
+}
+
+static void shell_cmd_start(uint8 argc , char *argv[])
+{
+    const shell_peripheral_t *l_peripheral = NULL;
+    if(2 == argc)
+    {
+        l_peripheral = shell_find_peripheral(argv[1]);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(NULL == l_peripheral)
+    {
+        shell_print("error: usage start <peripheral>, see help\r\n");
+    }
+    else
+    {
+        *(l_peripheral -> control) |= l_peripheral -> enable_mask;
+    }
+}
+
+static void shell_cmd_stop(uint8 argc , char *argv[])
+{
+    const shell_peripheral_t *l_peripheral = NULL;
+    if(2 == argc)
+    {
+        l_peripheral = shell_find_peripheral(argv[1]);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(NULL == l_peripheral)
+    {
+        shell_print("error: usage stop <peripheral>, see help\r\n");
+    }
+    else
+    {
+        *(l_peripheral -> control) &= (uint8)~(l_peripheral -> enable_mask);
+    }
+}
+
+/**
+ * @brief validate "<addr> [count]" and arm an incremental dump.
+ */
+static Std_ReturnType shell_dump_start(uint8 kind , uint8 argc , char *argv[] , uint16 memory_size)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_address = 0;
+    uint16 l_count = 1;
+    if((argc < 2) || (argc > 3) || (E_NOT_OK == shell_parse_number(argv[1] , &l_address)))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((3 == argc) && (E_NOT_OK == shell_parse_number(argv[2] , &l_count)))
+    {
+        ret = E_NOT_OK;
+    }
+    else if((l_address >= memory_size) || (0 == l_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(l_count > (memory_size - l_address))
+        {
+            l_count = memory_size - l_address;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        shell_dump_address = l_address;
+        shell_dump_remaining = l_count;
+        shell_dump_kind = kind;
+    }
+    return ret;
+}
+
+/**
+ * @brief print the next dump line, then the prompt after the last one.
+ */
+static void shell_dump_line(void)
+{
+    uint8 l_counter = 0;
+    uint8 l_data = 0;
+    shell_print("%04X:" , shell_dump_address);
+    while((l_counter < SHELL_BYTES_PER_LINE) && (shell_dump_remaining > 0))
+    {
+        if(SHELL_DUMP_EEPROM == shell_dump_kind)
+        {
+            Data_EEPROM_ReadByte(shell_dump_address , &l_data);
+        }
+        else
+        {
+            l_data = SHELL_DATA_MEMORY_BYTE(shell_dump_address);
+        }
+        shell_print(" %02X" , l_data);
+        shell_dump_address++;
+        shell_dump_remaining--;
+        l_counter++;
+    }
+    shell_print("\r\n");
+    if(0 == shell_dump_remaining)
+    {
+        shell_dump_kind = SHELL_DUMP_NONE;
+        shell_print(SHELL_CFG_PROMPT);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+/**
+ * @brief print the next help line, then the prompt after the last one.
+ */
+static void shell_help_line(void)
+{
+    uint8 l_builtin_count = (uint8)(sizeof(shell_commands) / sizeof(shell_command_t));
+    uint16 l_index = shell_dump_address;
+    uint8 l_counter = 0;
+    if(l_index < l_builtin_count)
+    {
+        shell_print("%-6s %s\r\n" , shell_commands[l_index].name , shell_commands[l_index].help);
+    }
+    else if((l_index - l_builtin_count) < shell_obj -> user_command_count)
+    {
+        l_index -= l_builtin_count;
+        shell_print("%-6s %s\r\n" , shell_obj -> user_commands[l_index].name ,
+                    shell_obj -> user_commands[l_index].help);
+    }
+    else
+    {
+        shell_print("peripherals:");
+        for(l_counter = 0 ; l_counter < (sizeof(shell_peripherals) / sizeof(shell_peripheral_t)) ; l_counter++)
+        {
+            shell_print(" %s" , shell_peripherals[l_counter].name);
+        }
+        shell_print("\r\n");
+    }
+    shell_dump_address++;
+    shell_dump_remaining--;
+    if(0 == shell_dump_remaining)
+    {
+        shell_dump_kind = SHELL_DUMP_NONE;
+        shell_print(SHELL_CFG_PROMPT);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static uint8 shell_string_equal(const char *first , const char *second)
+{
+    while(('\0' != *first) && (*first == *second))
+    {
+        first++;
+        second++;
+    }
+    return (uint8)(*first == *second);
+}
+
+static const shell_peripheral_t *shell_find_peripheral(const char *name)
+{
+    const shell_peripheral_t *l_peripheral = NULL;
+    uint8 l_counter = 0;
+    for(l_counter = 0 ; (l_counter < (sizeof(shell_peripherals) / sizeof(shell_peripheral_t))) &&
+                        (NULL == l_peripheral) ; l_counter++)
+    {
+        if(shell_string_equal(name , shell_peripherals[l_counter].name))
+        {
+            l_peripheral = &shell_peripherals[l_counter];
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return l_peripheral;
+}
@@ -0,0 +1,46 @@
+/* 
+ * File:   ecu_shell.h
+ */
+
+#ifndef ECU_SHELL_H
+#define	ECU_SHELL_H
+
+/******************Section: Includes**********************/
+#include <stdint.h>
+#include "ecu_shell_cfg.h"
+#include "../../MCAL_Layer/std_format.h"
+#include "../../MCAL_Layer/USART/hal_usart.h"
+#include "../../MCAL_Layer/EEPROM/hal_eeprom.h"
+#include "../../MCAL_Layer/Interrupt/mcal_interrupt_manager.h"
+
+/******************Section: Macros Declarations***********/
+#define SHELL_BYTES_PER_LINE             16U
+
+#if EUSART_CFG_RX_RING_BUFFER != EUSART_CFG_FEATURE_ENABLE
+#error "The shell reads its input from the EUSART RX ring buffer"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+    const char *name;
+    const char *help;
+    void (*handler)(uint8 argc , char *argv[]);   /*argv[0] is the command name*/
+}shell_command_t;
+
+typedef struct{
+    std_format_sink_t output;                      /*e.g. EUSART_ASYNCH_FormatSink*/
+    void *output_context;
+    const shell_command_t *user_commands;          /*Optional application commands*/
+    uint8 user_command_count;
+}shell_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType shell_initialize(const shell_t *shell);
+Std_ReturnType shell_process(void);
+Std_ReturnType shell_receive_byte(uint8 data);
+Std_ReturnType shell_print(const char *format , ...);
+Std_ReturnType shell_parse_number(const char *str , uint16 *value);
+
+#endif	/* ECU_SHELL_H */
@@ -0,0 +1,30 @@
+/* 
+ * File:   ecu_shell_cfg.h
+ */
+
+#ifndef ECU_SHELL_CFG_H
+#define	ECU_SHELL_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Longest command line, including the terminator*/
+#define SHELL_CFG_LINE_SIZE              40U
+/*Command name + arguments*/
+#define SHELL_CFG_MAX_ARGS               4U
+/*Received bytes handled per shell_process call*/
+#define SHELL_CFG_BYTES_PER_CALL         8U
+/*Size of the data EEPROM(PIC18F4620: 1024 bytes)*/
+#define SHELL_CFG_EEPROM_SIZE            1024U
+/*Size of the data memory space, RAM + SFRs(PIC18F4620: 4096 bytes)*/
+#define SHELL_CFG_DATA_MEMORY_SIZE       4096U
+
+#define SHELL_CFG_PROMPT                 "> "
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_SHELL_CFG_H */
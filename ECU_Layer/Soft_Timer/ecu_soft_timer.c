@@ -0,0 +1,357 @@
+/*
+ * File:   ecu_soft_timer.c
+ */
+
+#include "ecu_soft_timer.h"
+
+/*
+ * Delta list: the running timers are linked in expiry order and each one keeps the
+ *             ticks after the previous one, a tick only decrements the head(O(1)).
+ * Expiry    : the expired head is unlinked(a periodic timer is linked again) and its
+ *             callback runs from the Timer0 interrupt, outside the critical section.
+ * Critical  : start/stop/restart and the list updates of the tick clear GIE(GIEH with
+ *             priority levels) around the list, so any ISR and the main loop may call them.
+ */
+
+#define SOFT_TIMER_NONE              0xFFU
+
+typedef struct{
+    void(*callback)(uint8 timer_id);
+    uint32 period_ticks;    /*Timeout of start, reload of a periodic timer*/
+    uint32 delta_ticks;     /*Ticks after the previous timer of the list*/
+    uint8 next;
+    uint8 mode;
+    uint8 status;
+}soft_timer_t;
+
+static soft_timer_t soft_timers[SOFT_TIMER_CFG_MAX_TIMERS];
+static uint8 soft_timer_head = SOFT_TIMER_NONE;
+static volatile uint32 soft_timer_ticks = 0;
+static timer0_t soft_timer_timer0;
+
+static void soft_timer_tick_isr(void);
+static void soft_timer_link(uint8 timer_id , uint32 ticks);
+static void soft_timer_unlink(uint8 timer_id);
+
+/**
+ * @brief stop every virtual timer and start Timer0 with a SOFT_TIMER_CFG_TICK_MS overflow.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType soft_timer_initialize(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_timer_id = 0;
+    TIMER0_InterruptDisable();
+    for(l_timer_id = 0 ; l_timer_id < SOFT_TIMER_CFG_MAX_TIMERS ; l_timer_id++)
+    {
+        soft_timers[l_timer_id].callback = NULL;
+        soft_timers[l_timer_id].period_ticks = 0;
+        soft_timers[l_timer_id].status = SOFT_TIMER_STOPPED;
+    }
+    soft_timer_head = SOFT_TIMER_NONE;
+    soft_timer_ticks = 0;
+    soft_timer_timer0.TIMER0_InterruptHandler = soft_timer_tick_isr;
+    soft_timer_timer0.priority = SOFT_TIMER_CFG_PRIORITY;
+    soft_timer_timer0.prescaler_enable = SOFT_TIMER_TIMER0_PRESCALER;
+    soft_timer_timer0.prescaler_value = TIMER0_PRESCALER_DIV_BY_16;
+    soft_timer_timer0.timer0_mode = TIMER0_TIMER_MODE;
+    soft_timer_timer0.timer0_register_size = TIMER0_16BIT_REGISTER_MODE;
+    soft_timer_timer0.timer0_preload_value = SOFT_TIMER_TIMER0_PRELOAD;
+    ret = Timer0_Init(&soft_timer_timer0);
+    return ret;
+}
+
+/**
+ * @brief start a virtual timer, a running one is started again from now.
+ *        The first tick comes at any point of its period, so the callback runs
+ *        after timeout_ms - SOFT_TIMER_CFG_TICK_MS at the earliest.
+ * @param timer_id 0..SOFT_TIMER_CFG_MAX_TIMERS - 1.
+ * @param timeout_ms the timeout(and the period of a periodic timer), a multiple of SOFT_TIMER_CFG_TICK_MS.
+ * @param mode @ref soft_timer_mode_t.
+ * @param callback called from the Timer0 interrupt with the timer id, may be NULL.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the id, the mode or the timeout(shorter than a tick) is invalid.
+ */
+Std_ReturnType soft_timer_start(uint8 timer_id , uint32 timeout_ms , soft_timer_mode_t mode ,
+                                void(*callback)(uint8 timer_id))
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_ticks = timeout_ms / SOFT_TIMER_CFG_TICK_MS;
+    uint8 l_gie_status = 0;
+    if((timer_id >= SOFT_TIMER_CFG_MAX_TIMERS) || (mode > SOFT_TIMER_PERIODIC) || (0 == l_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_gie_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        soft_timer_unlink(timer_id);
+        soft_timers[timer_id].callback = callback;
+        soft_timers[timer_id].period_ticks = l_ticks;
+        soft_timers[timer_id].mode = mode;
+        soft_timer_link(timer_id , l_ticks);
+        INTCONbits.GIE = l_gie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief stop a virtual timer, its callback doesn't run anymore.
+ * @param timer_id 0..SOFT_TIMER_CFG_MAX_TIMERS - 1.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType soft_timer_stop(uint8 timer_id)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie_status = 0;
+    if(timer_id >= SOFT_TIMER_CFG_MAX_TIMERS)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_gie_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        soft_timer_unlink(timer_id);
+        INTCONbits.GIE = l_gie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief start a virtual timer again from now with the timeout, mode and callback
+ *        of its last soft_timer_start(running or not).
+ * @param timer_id 0..SOFT_TIMER_CFG_MAX_TIMERS - 1.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the timer was never started.
+ */
+Std_ReturnType soft_timer_restart(uint8 timer_id)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie_status = 0;
+    if((timer_id >= SOFT_TIMER_CFG_MAX_TIMERS) || (0 == soft_timers[timer_id].period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_gie_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        soft_timer_unlink(timer_id);
+        soft_timer_link(timer_id , soft_timers[timer_id].period_ticks);
+        INTCONbits.GIE = l_gie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief check if a virtual timer is running.
+ * @param timer_id 0..SOFT_TIMER_CFG_MAX_TIMERS - 1.
+ * @param status pointer to store SOFT_TIMER_RUNNING or SOFT_TIMER_STOPPED.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType soft_timer_get_status(uint8 timer_id , uint8 *status)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == status) || (timer_id >= SOFT_TIMER_CFG_MAX_TIMERS))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *status = soft_timers[timer_id].status;
+    }
+    return ret;
+}
+
+/**
+ * @brief get the ticks counted since soft_timer_initialize(wraps at 32 bits).
+ * @param ticks pointer to store the tick count.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType soft_timer_get_ticks(uint32 *ticks)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie_status = 0;
+    if(NULL == ticks)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_gie_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        *ticks = soft_timer_ticks;
+        INTCONbits.GIE = l_gie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief get a timestamp in Timer0 counts(SOFT_TIMER_TIMESTAMP_PER_MS per ms) built from
+ *        the tick count and the running Timer0, for measuring short intervals.
+ *        The difference of two timestamps is right across the 32-bit wrap.
+ * @param timestamp pointer to store the timestamp.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType soft_timer_get_timestamp(uint32 *timestamp)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_gie_status = 0;
+    uint16 l_tmr0_value = 0;
+    if(NULL == timestamp)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_gie_status = INTCONbits.GIE;
+        INTCONbits.GIE = 0;
+        l_tmr0_value = TMR0L;
+        l_tmr0_value += (uint16)TMR0H << 8;
+        if(INTCONbits.TMR0IF && (l_tmr0_value < SOFT_TIMER_TIMER0_PRELOAD))
+        {
+            /*Overflow not counted yet, Timer0 restarted from 0 and isn't reloaded*/
+            *timestamp = ((soft_timer_ticks + 1UL) * SOFT_TIMER_TIMESTAMP_PER_TICK) + l_tmr0_value;
+        }
+        else
+        {
+            *timestamp = (soft_timer_ticks * SOFT_TIMER_TIMESTAMP_PER_TICK) +
+                         (uint16)(l_tmr0_value - SOFT_TIMER_TIMER0_PRELOAD);
+        }
+        INTCONbits.GIE = l_gie_status;
+    }
+    return ret;
+}
+
+/*Timer0 handler: count down the head, then expire every timer that reached 0*/
+static void soft_timer_tick_isr(void)
+{
+    uint8 l_gie_status = INTCONbits.GIE;
+    uint8 l_timer_id = SOFT_TIMER_NONE;
+    void(*l_callback)(uint8 timer_id) = NULL;
+    INTCONbits.GIE = 0;
+    soft_timer_ticks++;
+    if((SOFT_TIMER_NONE != soft_timer_head) && (soft_timers[soft_timer_head].delta_ticks > 0))
+    {
+        soft_timers[soft_timer_head].delta_ticks--;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    INTCONbits.GIE = l_gie_status;
+    do
+    {
+        INTCONbits.GIE = 0;
+        l_timer_id = soft_timer_head;
+        if((SOFT_TIMER_NONE != l_timer_id) && (0 == soft_timers[l_timer_id].delta_ticks))
+        {
+            /*Linked again before the callback, so the callback may stop or restart it*/
+            soft_timer_unlink(l_timer_id);
+            if(SOFT_TIMER_PERIODIC == soft_timers[l_timer_id].mode)
+            {
+                soft_timer_link(l_timer_id , soft_timers[l_timer_id].period_ticks);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            l_callback = soft_timers[l_timer_id].callback;
+        }
+        else
+        {
+            l_timer_id = SOFT_TIMER_NONE;
+        }
+        INTCONbits.GIE = l_gie_status;
+        if((SOFT_TIMER_NONE != l_timer_id) && (NULL != l_callback))
+        {
+            l_callback(l_timer_id);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }while(SOFT_TIMER_NONE != l_timer_id);
+}
+
+/*Insert after the timers expiring at the same tick(start order), called with GIE cleared*/
+static void soft_timer_link(uint8 timer_id , uint32 ticks)
+{
+    uint8 l_previous = SOFT_TIMER_NONE;
+    uint8 l_current = soft_timer_head;
+    while((SOFT_TIMER_NONE != l_current) && (ticks >= soft_timers[l_current].delta_ticks))
+    {
+        ticks -= soft_timers[l_current].delta_ticks;
+        l_previous = l_current;
+        l_current = soft_timers[l_current].next;
+    }
+    soft_timers[timer_id].delta_ticks = ticks;
+    soft_timers[timer_id].next = l_current;
+    soft_timers[timer_id].status = SOFT_TIMER_RUNNING;
+    if(SOFT_TIMER_NONE != l_current)
+    {
+        soft_timers[l_current].delta_ticks -= ticks;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(SOFT_TIMER_NONE == l_previous)
+    {
+        soft_timer_head = timer_id;
+    }
+    else
+    {
+        soft_timers[l_previous].next = timer_id;
+    }
+}
+
+/*Remove a running timer, its ticks go to the next one, called with GIE cleared*/
+static void soft_timer_unlink(uint8 timer_id)
+{
+    uint8 l_previous = SOFT_TIMER_NONE;
+    uint8 l_current = soft_timer_head;
+    if(SOFT_TIMER_RUNNING == soft_timers[timer_id].status)
+    {
+        while(timer_id != l_current)
+        {
+            l_previous = l_current;
+            l_current = soft_timers[l_current].next;
+        }
+        if(SOFT_TIMER_NONE != soft_timers[timer_id].next)
+        {
+            soft_timers[soft_timers[timer_id].next].delta_ticks += soft_timers[timer_id].delta_ticks;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(SOFT_TIMER_NONE == l_previous)
+        {
+            soft_timer_head = soft_timers[timer_id].next;
+        }
+        else
+        {
+            soft_timers[l_previous].next = soft_timers[timer_id].next;
+        }
+        soft_timers[timer_id].status = SOFT_TIMER_STOPPED;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * File:   ecu_soft_timer.h
+ */
+
+#ifndef ECU_SOFT_TIMER_H
+#define	ECU_SOFT_TIMER_H
+
+/******************Section: Includes**********************/
+#include "ecu_soft_timer_cfg.h"
+#include "../../MCAL_Layer/Timer0/hal_timer0.h"
+
+/******************Section: Macros Declarations***********/
+#define SOFT_TIMER_STOPPED           0x00U
+#define SOFT_TIMER_RUNNING           0x01U
+
+/*Timer0 counts(Fosc / 4) per tick, the prescaler is only used when a tick doesn't fit 16 bits*/
+#define SOFT_TIMER_TICK_COUNTS       (SOFT_TIMER_CFG_TICK_MS * ((_XTAL_FREQ / 4UL) / 1000UL))
+
+#if SOFT_TIMER_TICK_COUNTS <= 0x10000UL
+#define SOFT_TIMER_TIMER0_PRESCALER  TIMER0_PRESCALER_DISABLE_CGF
+#define SOFT_TIMER_TIMER0_PRELOAD    ((uint16)(0x10000UL - SOFT_TIMER_TICK_COUNTS))
+#define SOFT_TIMER_TIMESTAMP_PER_TICK    SOFT_TIMER_TICK_COUNTS
+#elif (SOFT_TIMER_TICK_COUNTS / 16UL) <= 0x10000UL
+#define SOFT_TIMER_TIMER0_PRESCALER  TIMER0_PRESCALER_ENABLE_CGF    /*TIMER0_PRESCALER_DIV_BY_16*/
+#define SOFT_TIMER_TIMER0_PRELOAD    ((uint16)(0x10000UL - (SOFT_TIMER_TICK_COUNTS / 16UL)))
+#define SOFT_TIMER_TIMESTAMP_PER_TICK    (SOFT_TIMER_TICK_COUNTS / 16UL)
+#else
+#error "SOFT_TIMER_CFG_TICK_MS is too long for the 16-bit Timer0"
+#endif
+
+/*Timestamp unit: one Timer0 count*/
+#define SOFT_TIMER_TIMESTAMP_PER_MS  (SOFT_TIMER_TIMESTAMP_PER_TICK / SOFT_TIMER_CFG_TICK_MS)
+
+#if SOFT_TIMER_CFG_TICK_MS == 0UL
+#error "SOFT_TIMER_CFG_TICK_MS must be at least 1"
+#endif
+
+#if (SOFT_TIMER_CFG_MAX_TIMERS == 0U) || (SOFT_TIMER_CFG_MAX_TIMERS > 254U)
+#error "SOFT_TIMER_CFG_MAX_TIMERS must be 1 - 254"
+#endif
+
+#if TIMER0_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE
+#error "The software timers are ticked from the TIMER0 interrupt"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    SOFT_TIMER_ONE_SHOT = 0,
+    SOFT_TIMER_PERIODIC
+}soft_timer_mode_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType soft_timer_initialize(void);
+Std_ReturnType soft_timer_start(uint8 timer_id , uint32 timeout_ms , soft_timer_mode_t mode ,
+                                void(*callback)(uint8 timer_id));
+Std_ReturnType soft_timer_stop(uint8 timer_id);
+Std_ReturnType soft_timer_restart(uint8 timer_id);
+Std_ReturnType soft_timer_get_status(uint8 timer_id , uint8 *status);
+Std_ReturnType soft_timer_get_ticks(uint32 *ticks);
+Std_ReturnType soft_timer_get_timestamp(uint32 *timestamp);
+
+#endif	/* ECU_SOFT_TIMER_H */
@@ -0,0 +1,26 @@
+/*
+ * File:   ecu_soft_timer_cfg.h
+ */
+
+#ifndef ECU_SOFT_TIMER_CFG_H
+#define	ECU_SOFT_TIMER_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+/*Virtual timers, the ids are 0..SOFT_TIMER_CFG_MAX_TIMERS - 1(at most 254)*/
+#define SOFT_TIMER_CFG_MAX_TIMERS    8U
+
+/*Timer0 overflow period, the resolution of every virtual timer*/
+#define SOFT_TIMER_CFG_TICK_MS       1UL
+
+/*Priority of the Timer0 interrupt, the callbacks run at this priority*/
+#define SOFT_TIMER_CFG_PRIORITY      INTERRUPT_LOW_PRIORITY
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* ECU_SOFT_TIMER_CFG_H */
@@ -1,22 +1,22 @@
-/* 
- * File:   ecu_layer_init.h
- * Author: yousg
- *
- * Created on March 4, 2025, 2:40 PM
- */
-
-#ifndef ECU_LAYER_INIT_H
-#define	ECU_LAYER_INIT_H
-
-#include "7_Segment/ecu_seven_segment.h"
-#include "LED/ecu_led.h"
-#include "Relay/ecu_relay.h"
-#include "DC_Motor/ecu_dc_motor.h"
-#include "button/ecu_button.h"
-#include "Keypad/ecu_keypad.h"
-#include "Chr_LCD/ecu_chr_LCD.h"
-
-void ecu_layer_initialize();
-
-#endif	/* ECU_LAYER_INIT_H */
-
+/* 
+ * File:   ecu_layer_init.h
+ * Author: yousg
+ *
+ * Created on March 4, 2025, 2:40 PM
+ */
+
+#ifndef ECU_LAYER_INIT_H
+#define	ECU_LAYER_INIT_H
+
+#include "7_Segment/ecu_seven_segment.h"
+#include "LED/ecu_led.h"
+#include "Relay/ecu_relay.h"
+#include "DC_Motor/ecu_dc_motor.h"
+#include "button/ecu_button.h"
+#include "Keypad/ecu_keypad.h"
+#include "Chr_LCD/ecu_chr_LCD.h"
+
+void ecu_layer_initialize();
+
+#endif	/* ECU_LAYER_INIT_H */
+
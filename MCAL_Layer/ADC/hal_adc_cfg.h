@@ -1,22 +1,22 @@
-/* 
- * File:   hal_adc_cfg.h
- * Author: yousg
- *
- * Created on March 16, 2025, 5:02 PM
- */
-
-#ifndef HAL_ADC_CFG_H
-#define	HAL_ADC_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* HAL_ADC_CFG_H */
-
+/* 
+ * File:   hal_adc_cfg.h
+ * Author: yousg
+ *
+ * Created on March 16, 2025, 5:02 PM
+ */
+
+#ifndef HAL_ADC_CFG_H
+#define	HAL_ADC_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* HAL_ADC_CFG_H */
+
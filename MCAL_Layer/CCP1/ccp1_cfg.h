@@ -1,26 +1,36 @@
-/* 
- * File:   ccp1_cfg.h
- * Author: Yousab Gamal
- * Created on March 31, 2025, 4:44 PM
- */
-
-#ifndef CCP1_CFG_H
-#define	CCP1_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-#define CCP_CFG_CAPTURE_MODE_SELECTED      0x00 
-#define CCP_CFG_COMPARE_MODE_SELECTED      0x01 
-#define CCP_CFG_PWM_MODE_SELECTED           0x02
-
-#define CCP_CFG_SELECTED_MODE      CCP_CFG_COMPARE_MODE_SELECTED
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* CCP1_CFG_H */
-
+/* 
+ * File:   ccp1_cfg.h
+ * Author: Yousab Gamal
+ * Created on March 31, 2025, 4:44 PM
+ */
+
+#ifndef CCP1_CFG_H
+#define	CCP1_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define CCP_CFG_FEATURE_ENABLE          1
+#define CCP_CFG_FEATURE_DISABLE         0
+
+/*Double-buffered PWM: duty/frequency are staged and applied from the Timer2 period
+  match interrupt, they take effect in the same PWM period(needs TIMER2_INTERRUPT_FEATURE_ENABLE)*/
+#define CCP_CFG_PWM_STAGED_UPDATE       CCP_CFG_FEATURE_ENABLE
+
+/*Capture timestamps extended to 32 bits with the Timer1/Timer3 overflows, period/frequency/duty
+  measured in the CCP interrupt(needs the CCP1, CCP2, TIMER1 and TIMER3 interrupt features)*/
+#define CCP_CFG_CAPTURE_METER           CCP_CFG_FEATURE_ENABLE
+
+/*Constant PWM frequency checked at compile time against _XTAL_FREQ(0: none), use it with
+  .prescaler_value = CCP_TIMER2_PRESCALER_AUTO or CCP_PWM_AUTO_PRESCALER(CCP_CFG_PWM_FREQUENCY)*/
+#define CCP_CFG_PWM_FREQUENCY           0UL
+#define CCP_CFG_PWM_MIN_RESOLUTION_BITS 8U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* CCP1_CFG_H */
+
@@ -1,567 +1,1820 @@
-/* 
- * File:   hal_ccp1.c
- * Author: Yousab Gamal
- * Created on March 31, 2025, 4:42 PM
- */
-
-#include "hal_ccp1.h"
-
-static void CCP_InterruptConfig(const ccp_t *ccp_obj);
-static void CCP_CaptureModeTimerselect(const ccp_t *ccp_obj);
-
-#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    static void(*CCP1_InterruptHandler)(void);
-#endif
-#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    static void(*CCP2_InterruptHandler)(void);
-#endif
-
-/**
- * @brief initialize CCP1 moduleby writing the desired value in CCP1CON register. 
- * @param ccp_obj pointer points to ccp1_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_Init(const ccp_t *ccp_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCP1_SET_MODE(CCP_MODULE_DISABLE);
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCP2_SET_MODE(CCP_MODULE_DISABLE);
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-        if(CCP_CAPTURE_MODE_SELECT == ccp_obj -> CCP_mode)
-        {
-            if(CCP1_INST == ccp_obj -> ccp_inst)
-            {
-                switch(ccp_obj -> CCP_mode_variant)
-                {
-                    case CCP_CAPTURE_MODE_1_FALLING_EDGE:
-                        CCP1_SET_MODE(CCP_CAPTURE_MODE_1_FALLING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_1_RISING_EDGE:
-                        CCP1_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_4_RISING_EDGE:
-                        CCP1_SET_MODE(CCP_CAPTURE_MODE_4_RISING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_16_RISING_EDGE:
-                        CCP1_SET_MODE(CCP_CAPTURE_MODE_16_RISING_EDGE);
-                        break;   
-                    default:
-                        ret = E_NOT_OK;
-                        break;
-                }
-            }
-            else if(CCP2_INST == ccp_obj -> ccp_inst)
-            {
-                switch(ccp_obj -> CCP_mode_variant)
-                {
-                    case CCP_CAPTURE_MODE_1_FALLING_EDGE:
-                        CCP2_SET_MODE(CCP_CAPTURE_MODE_1_FALLING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_1_RISING_EDGE:
-                        CCP2_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_4_RISING_EDGE:
-                        CCP2_SET_MODE(CCP_CAPTURE_MODE_4_RISING_EDGE);
-                        break;
-                    case CCP_CAPTURE_MODE_16_RISING_EDGE:
-                        CCP2_SET_MODE(CCP_CAPTURE_MODE_16_RISING_EDGE);
-                        break;   
-                    default:
-                        ret = E_NOT_OK;
-                        break;
-                }
-            }
-            else
-            {
-                /*NOTHING*/
-            }
-            CCP_CaptureModeTimerselect(ccp_obj);
-        }
-        else if(CCP_COMPARE_MODE_SELECT == ccp_obj -> CCP_mode)
-        {
-            if(CCP1_INST == ccp_obj -> ccp_inst)
-            {
-                switch(ccp_obj -> CCP_mode_variant)
-                {
-                    case CCP_COMPARE_MODE_SET_PIN_LOW:
-                        CCP1_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW);
-                        break;
-                    case CCP_COMPARE_MODE_SET_PIN_HIGH:
-                        CCP1_SET_MODE(CCP_COMPARE_MODE_SET_PIN_HIGH);
-                        break;
-                    case CCP_COMPARE_MODE_TOGGLE_ON_MATCH:
-                        CCP1_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH);
-                        break;
-                    case CCP_COMPARE_MODE_GEN_SW_INTERRUPT:
-                        CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
-                        break; 
-                    case CCP_COMPARE_MODE_GEN_EVENT:
-                        CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_EVENT);
-                        break;    
-                    default:
-                        ret = E_NOT_OK;
-                        break;
-                }
-            }
-            else if(CCP2_INST == ccp_obj -> ccp_inst)
-            {
-                switch(ccp_obj -> CCP_mode_variant)
-                {
-                    case CCP_COMPARE_MODE_SET_PIN_LOW:
-                        CCP2_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW);
-                        break;
-                    case CCP_COMPARE_MODE_SET_PIN_HIGH:
-                        CCP2_SET_MODE(CCP_COMPARE_MODE_SET_PIN_HIGH);
-                        break;
-                    case CCP_COMPARE_MODE_TOGGLE_ON_MATCH:
-                        CCP2_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH);
-                        break;
-                    case CCP_COMPARE_MODE_GEN_SW_INTERRUPT:
-                        CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
-                        break; 
-                    case CCP_COMPARE_MODE_GEN_EVENT:
-                        CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_EVENT);
-                        break;    
-                    default:
-                        ret = E_NOT_OK;
-                        break;
-                }
-            }
-            else
-            {
-                /*NOTHING*/
-            }
-            CCP_CaptureModeTimerselect(ccp_obj);
-        }
-        else if(CCP_PWM_MODE_SELECT == ccp_obj -> CCP_mode)
-        {
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_PWM_MODE_SELECTED
-            switch(ccp_obj -> ccp_inst)
-            {
-                case CCP1_INST:
-                    CCP1_SET_MODE(CCP_PWM_MODE);
-                    break;
-                case CCP2_INST:
-                    CCP2CONbits.CCP2M = CCP_PWM_MODE;
-                    break;
-                default:
-                    ret = E_NOT_OK;
-                    break;    
-            }
-            PR2 = (uint8)((_XTAL_FREQ / (ccp_obj -> PWM_frequency * 4.0 * 
-                        ccp_obj -> postscaler_value * ccp_obj -> prescaler_value))-1);
-#endif        
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-        ret = gpio_pin_intialize(&ccp_obj -> pin_init);
-        CCP_InterruptConfig(ccp_obj);
-    }
-    return ret;
-}
-
-/**
- * @brief de initialize CCP1 module. 
- * @param ccp_obj pointer points to ccp_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_DeInit(const ccp_t *ccp_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCP1_SET_MODE(CCP_MODULE_DISABLE);
-#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-         CCP1_InterruptDisable();
-#endif
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCP2_SET_MODE(CCP_MODULE_DISABLE);
-#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-        CCP2_InterruptDisable();
-#endif     
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_PWM_MODE_SELECTED
-/**
- * @breif calculate the value that should be store in... 
- *        -if CCP1 enabled: CCPR1L register and DC1B(two bits).
- *        -if CCP2 enabled: CCPR2L register and DC2B(two bits).
- * @param duty hold the duty cycle in percents.
- * @param ccp_obj pointer points to ccp_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_PWM_SetDuty(const ccp_t *ccp_obj , const uint8 duty)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        uint16 l_duty_temp = 0;
-        l_duty_temp = (uint16)(4 * (PR2 + 1) * (duty / 100.0));  
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCP1CONbits.DC1B = (uint8)(l_duty_temp & 0x03);
-            CCPR1L = (uint8)(l_duty_temp >> 2);
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCP2CONbits.DC2B = (uint8)(l_duty_temp & 0x03);
-            CCPR2L = (uint8)(l_duty_temp >> 2);
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief enable CCP PWM module.
- * @param ccp_obj pointer points to ccp_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_PWM_Start(const ccp_t *ccp_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCP1_SET_MODE(CCP_PWM_MODE);
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCP2CONbits.CCP2M = CCP_PWM_MODE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief disable the whole CCP module.
- * @param ccp_obj pointer points to ccp_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function. 
- */
-Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCP1_SET_MODE(CCP_MODULE_DISABLE);
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCP2CONbits.CCP2M = CCP_MODULE_DISABLE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-#endif
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_COMPARE_MODE_SELECTED
-/**
- * @breif check CCP1IF if (CCP1IF = 1): CCP1IF = 0.
- * @param compare_status pointer to store CCP1IF status.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_IsCompareComplete(uint8 *compare_status)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == compare_status)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_COMPARE_READY == PIR1bits.CCP1IF)
-        {
-            *compare_status = CCP1_COMPARE_READY;
-            CCP1_InterruptFlagClear();
-        }
-        else if(CCP1_COMPARE_NOT_READY == PIR1bits.CCP1IF)
-        {
-            *compare_status = CCP1_COMPARE_NOT_READY;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief write the desired value in CCPR1H and CCPR1L;
- * @param compare_value hold the desired value.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_CompareModeSetValue(const ccp_t *ccp_obj ,uint16 compare_value)
-{
-    Std_ReturnType ret = E_OK;
-    ccp_reg_t capture_temp_value ={.ccpr_low = 0 , .ccpr_high = 0};
-    capture_temp_value.ccpr_16bit = compare_value;
-    if(NULL == ccp_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_INST == ccp_obj -> ccp_inst)
-        {
-            CCPR1L = capture_temp_value.ccpr_low;
-            CCPR1H = capture_temp_value.ccpr_high;
-        }
-        else if(CCP2_INST == ccp_obj -> ccp_inst)
-        {
-            CCPR2L = capture_temp_value.ccpr_low;
-            CCPR2H = capture_temp_value.ccpr_high;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-#endif
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_CAPTURE_MODE_SELECTED
-/**
- * @breif check CCP1IF if (CCP1IF = 1): CCP1IF = 0.
- * @param capture_status pointer to store CCP1IF status.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_IsCaptureReady(uint8 *capture_status)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == capture_status)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        if(CCP1_CAPTURE_READY == PIR1bits.CCP1IF)
-        {
-            *capture_status = CCP1_CAPTURE_READY;
-            CCP1_InterruptFlagClear();
-        }
-        else if(CCP1_CAPTURE_NOT_READY == PIR1bits.CCP1IF)
-        {
-            *capture_status = CCP1_CAPTURE_NOT_READY;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    return ret;
-}
-
-/**
- * @breif read and store CCPR1H + CCPR1L in a pointer variable.
- * @param capture_value pointer to store CCPR1H + CCPR1L.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType CCP_CaptureModeReadValue(uint16 *capture_value)
-{
-    Std_ReturnType ret = E_OK;
-    ccp_reg_t capture_temp_value ={.ccpr_low = 0 , .ccpr_high = 0};
-    if(NULL == capture_value)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        capture_temp_value.ccpr_low = CCPR1L;
-        capture_temp_value.ccpr_high = CCPR1H;
-        *capture_value = capture_temp_value.ccpr_16bit;
-    }
-    return ret;
-}
-#endif
-
-
-void CCP1_ISR(void)
-{
-    CCP1_InterruptFlagClear();
-    if(CCP1_InterruptHandler)
-    {
-        CCP1_InterruptHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-void CCP2_ISR(void)
-{
-    CCP2_InterruptFlagClear();
-    if(CCP2_InterruptHandler)
-    {
-        CCP2_InterruptHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-/**
- * @breif enable interrupt for CCP1 or CCP2.
- * @param ccp_obj pointer points to ccp_t data.
- */
-static void CCP_InterruptConfig(const ccp_t *ccp_obj)
-{
-#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    CCP2_InterruptEnable();
-    CCP2_InterruptFlagClear();
-    CCP2_InterruptHandler = ccp_obj -> CCP2_InterruptHandler;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_PriorityLevelEnable();
-    if(INTERRUPT_HIGH_PRIORITY == ccp_obj -> ccp2_priority)
-    {
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP2_HighPrioritySet();
-    }
-    else if(INTERRUPT_LOW_PRIORITY == ccp_obj -> ccp2_priority)
-    {
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP2_LowPrioritySet();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-#else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
-#endif
-#endif
-        
-#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    CCP1_InterruptEnable();
-    CCP1_InterruptFlagClear();
-    CCP1_InterruptHandler = ccp_obj -> CCP1_InterruptHandler;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-    INTERRUPT_PriorityLevelEnable();
-    if(INTERRUPT_HIGH_PRIORITY == ccp_obj -> ccp1_priority)
-    {
-        INTERRUPT_GlobalInterruptHighEnable();
-        CCP1_HighPrioritySet();
-    }
-    else if(INTERRUPT_LOW_PRIORITY == ccp_obj -> ccp1_priority)
-    {
-        INTERRUPT_GlobalInterruptLowEnable();
-        CCP1_LowPrioritySet();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-#else
-    INTERRUPT_GlobalInterruptEnable();
-    INTERRUPT_PeripheralInterruptEnable();
-#endif
-#endif
-}
-
-/**
- * @brief select which timer should be enabled 
- *        according to the choosen CCP module(CCP1 or CCP2).
- * @param ccp_obj pointer points to ccp_t data.
- */
-static void CCP_CaptureModeTimerselect(const ccp_t *ccp_obj)
-{
-    if(CCP1_CCP2_TIMER3 == ccp_obj -> ccp_capture_timer)
-    {
-        T3CONbits.T3CCP1 = 0;
-        T3CONbits.T3CCP2 = 1;
-    }
-    else if(CCP1_TIMER1_CCP2_TIMER3 == ccp_obj -> ccp_capture_timer)
-    {
-        T3CONbits.T3CCP1 = 1;
-        T3CONbits.T3CCP2 = 0;
-    }
-    else if(CCP1_CCP2_TIMER1 == ccp_obj -> ccp_capture_timer)
-    {
-        T3CONbits.T3CCP1 = 0;
-        T3CONbits.T3CCP2 = 0;
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
\ No newline at end of file
+/* 
+ * File:   hal_ccp1.c
+ * Author: Yousab Gamal
+ * Created on March 31, 2025, 4:42 PM
+ */
+
+#include "hal_ccp1.h"
+
+static void CCP_InterruptConfig(const ccp_t *ccp_obj);
+static void CCP_CaptureModeTimerselect(const ccp_t *ccp_obj);
+static Std_ReturnType CCP_ReadEventFlag(const ccp_t *ccp_obj , uint8 *event_status);
+static Std_ReturnType CCP_PWM_PeriodConfig(const ccp_t *ccp_obj);
+static Std_ReturnType CCP_PWM_PeriodCompute(uint32 frequency , uint8 prescaler_value , uint32 *period);
+static Std_ReturnType CCP_PWM_PrescalerBits(uint8 prescaler_value , uint8 *prescaler_bits);
+static void CCP_PWM_FillTiming(uint8 prescaler_value , uint32 period , ccp_pwm_timing_t *timing);
+static uint16 CCP_PWM_Q16ToCounts(uint16 duty_fraction , uint16 period_counts);
+static void CCP_PWM_WriteDuty(ccp_inst instance , uint16 duty_counts);
+
+/*Cached at CCP_Init(PWM), PR2 is shared by both instances*/
+static uint16 ccp_pwm_period_counts = 0;    /*4 * (PR2 + 1): duty counts of 100%*/
+static uint32 ccp_pwm_percent_scale = 0;    /*Duty counts per 1%, Q16*/
+
+/*Timer2 prescalers in search order(finest PR2 first)*/
+static const uint8 ccp_pwm_prescalers[] = {
+    CCP_TIMER2_PRESCALER_DIV_BY_1 , CCP_TIMER2_PRESCALER_DIV_BY_4 , CCP_TIMER2_PRESCALER_DIV_BY_16
+};
+
+#if CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE
+typedef struct{
+    uint16 duty_value[2];       /*Indexed by ccp_inst, counts(Q16 fraction while staged with StageDutyQ16)*/
+    uint16 period_counts;
+    uint32 percent_scale;
+    uint8 pr2_value;
+    uint8 prescaler_bits;       /*T2CKPS*/
+    uint8 staged;               /*@ref CCP_PWM_STAGED_NONE ...*/
+    uint8 duty_is_q16;          /*CCP_PWM_STAGED_CCPx_DUTY bits, staging side only*/
+}ccp_pwm_shadow_t;
+
+static void CCP_PWM_ApplyStaged(void);
+
+/*Filled by the CCP_PWM_Stage... calls(application only)*/
+static ccp_pwm_shadow_t ccp_pwm_staging;
+/*Committed values, applied by the Timer2 ISR at the period match*/
+static volatile ccp_pwm_shadow_t ccp_pwm_shadow;
+#endif
+
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+typedef struct{
+    uint32 reference_edge;      /*32-bit timestamp of the last period edge*/
+    uint32 period_ticks;        /*edges_per_period signal periods*/
+    uint32 active_ticks;        /*Period edge to the opposite edge(1x modes)*/
+    uint8 edges_per_period;     /*Capture prescaler 1, 4 or 16, 0: meter off*/
+    uint8 reference_mode;       /*CCP_CAPTURE_MODE_xxx of the period edge*/
+    uint8 status;               /*@ref CCP_CAPTURE_METER_IDLE ...*/
+}ccp_capture_meter_t;
+
+static Std_ReturnType CCP_Capture_MeterStart(const ccp_t *ccp_obj);
+static void CCP_Capture_MeterUpdate(ccp_inst instance);
+static uint32 CCP_Capture_Extend(ccp_inst instance , uint16 capture_value);
+static uint8 CCP_Capture_UsesTimer3(ccp_inst instance);
+static uint32 CCP_Capture_TickFrequency(ccp_inst instance);
+static void CCP_Capture_SetEdge(ccp_inst instance , uint8 capture_mode);
+static Std_ReturnType CCP_Capture_ReadMeter(const ccp_t *ccp_obj , ccp_capture_meter_t *meter);
+static uint32 CCP_Capture_Divide(uint32 numerator , uint32 denominator , uint8 decimal_digits);
+static void CCP_Capture_Timer1Overflow(void);
+static void CCP_Capture_Timer3Overflow(void);
+
+static volatile ccp_capture_meter_t ccp_capture_meter[2];    /*Indexed by ccp_inst*/
+/*Upper 16 bits of the timestamps, counted by the timer ISRs*/
+static volatile uint16 ccp_capture_timer1_overflows = 0;
+static volatile uint16 ccp_capture_timer3_overflows = 0;
+#endif
+
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    static void(*CCP1_InterruptHandler)(void);
+#endif
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    static void(*CCP2_InterruptHandler)(void);
+#endif
+
+/**
+ * @brief initialize CCP1 moduleby writing the desired value in CCP1CON register. 
+ * @param ccp_obj pointer points to ccp1_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_Init(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (ccp_obj -> ccp_inst > CCP2_INST))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_MODULE_DISABLE);
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            CCP2_SET_MODE(CCP_MODULE_DISABLE);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+        ccp_capture_meter[ccp_obj -> ccp_inst].edges_per_period = 0;
+#endif
+        if(CCP_CAPTURE_MODE_SELECT == ccp_obj -> CCP_mode)
+        {
+            if(CCP1_INST == ccp_obj -> ccp_inst)
+            {
+                switch(ccp_obj -> CCP_mode_variant)
+                {
+                    case CCP_CAPTURE_MODE_1_FALLING_EDGE:
+                        CCP1_SET_MODE(CCP_CAPTURE_MODE_1_FALLING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_1_RISING_EDGE:
+                        CCP1_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_4_RISING_EDGE:
+                        CCP1_SET_MODE(CCP_CAPTURE_MODE_4_RISING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_16_RISING_EDGE:
+                        CCP1_SET_MODE(CCP_CAPTURE_MODE_16_RISING_EDGE);
+                        break;   
+                    default:
+                        ret = E_NOT_OK;
+                        break;
+                }
+            }
+            else if(CCP2_INST == ccp_obj -> ccp_inst)
+            {
+                switch(ccp_obj -> CCP_mode_variant)
+                {
+                    case CCP_CAPTURE_MODE_1_FALLING_EDGE:
+                        CCP2_SET_MODE(CCP_CAPTURE_MODE_1_FALLING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_1_RISING_EDGE:
+                        CCP2_SET_MODE(CCP_CAPTURE_MODE_1_RISING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_4_RISING_EDGE:
+                        CCP2_SET_MODE(CCP_CAPTURE_MODE_4_RISING_EDGE);
+                        break;
+                    case CCP_CAPTURE_MODE_16_RISING_EDGE:
+                        CCP2_SET_MODE(CCP_CAPTURE_MODE_16_RISING_EDGE);
+                        break;   
+                    default:
+                        ret = E_NOT_OK;
+                        break;
+                }
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            CCP_CaptureModeTimerselect(ccp_obj);
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+            if(E_OK == ret)
+            {
+                ret = CCP_Capture_MeterStart(ccp_obj);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#endif
+        }
+        else if(CCP_COMPARE_MODE_SELECT == ccp_obj -> CCP_mode)
+        {
+            if(CCP1_INST == ccp_obj -> ccp_inst)
+            {
+                switch(ccp_obj -> CCP_mode_variant)
+                {
+                    case CCP_COMPARE_MODE_SET_PIN_LOW:
+                        CCP1_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW);
+                        break;
+                    case CCP_COMPARE_MODE_SET_PIN_HIGH:
+                        CCP1_SET_MODE(CCP_COMPARE_MODE_SET_PIN_HIGH);
+                        break;
+                    case CCP_COMPARE_MODE_TOGGLE_ON_MATCH:
+                        CCP1_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH);
+                        break;
+                    case CCP_COMPARE_MODE_GEN_SW_INTERRUPT:
+                        CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+                        break; 
+                    case CCP_COMPARE_MODE_GEN_EVENT:
+                        CCP1_SET_MODE(CCP_COMPARE_MODE_GEN_EVENT);
+                        break;    
+                    default:
+                        ret = E_NOT_OK;
+                        break;
+                }
+            }
+            else if(CCP2_INST == ccp_obj -> ccp_inst)
+            {
+                switch(ccp_obj -> CCP_mode_variant)
+                {
+                    case CCP_COMPARE_MODE_SET_PIN_LOW:
+                        CCP2_SET_MODE(CCP_COMPARE_MODE_SET_PIN_LOW);
+                        break;
+                    case CCP_COMPARE_MODE_SET_PIN_HIGH:
+                        CCP2_SET_MODE(CCP_COMPARE_MODE_SET_PIN_HIGH);
+                        break;
+                    case CCP_COMPARE_MODE_TOGGLE_ON_MATCH:
+                        CCP2_SET_MODE(CCP_COMPARE_MODE_TOGGLE_ON_MATCH);
+                        break;
+                    case CCP_COMPARE_MODE_GEN_SW_INTERRUPT:
+                        CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_SW_INTERRUPT);
+                        break; 
+                    case CCP_COMPARE_MODE_GEN_EVENT:
+                        CCP2_SET_MODE(CCP_COMPARE_MODE_GEN_EVENT);
+                        break;    
+                    default:
+                        ret = E_NOT_OK;
+                        break;
+                }
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            CCP_CaptureModeTimerselect(ccp_obj);
+        }
+        else if(CCP_PWM_MODE_SELECT == ccp_obj -> CCP_mode)
+        {
+            switch(ccp_obj -> ccp_inst)
+            {
+                case CCP1_INST:
+                    CCP1_SET_MODE(CCP_PWM_MODE);
+                    break;
+                case CCP2_INST:
+                    CCP2CONbits.CCP2M = CCP_PWM_MODE;
+                    break;
+                default:
+                    ret = E_NOT_OK;
+                    break;    
+            }
+            if(E_OK == ret)
+            {
+                ret = CCP_PWM_PeriodConfig(ccp_obj);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#if CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE
+            if(E_OK == ret)
+            {
+                /*One hook for both instances, they share PR2 and the period boundary*/
+                ret = Timer2_Set_Period_Match_Hook(CCP_PWM_ApplyStaged);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#endif
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        if(E_OK == ret)
+        {
+            ret = gpio_pin_intialize(&ccp_obj -> pin_init);
+            CCP_InterruptConfig(ccp_obj);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief de initialize CCP1 module. 
+ * @param ccp_obj pointer points to ccp_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_DeInit(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == ccp_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+        if(ccp_obj -> ccp_inst <= CCP2_INST)
+        {
+            ccp_capture_meter[ccp_obj -> ccp_inst].edges_per_period = 0;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_MODULE_DISABLE);
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            CCP1_InterruptDisable();
+            CCP1_InterruptHandler = NULL;
+#endif
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            CCP2_SET_MODE(CCP_MODULE_DISABLE);
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            CCP2_InterruptDisable();
+            CCP2_InterruptHandler = NULL;
+#endif
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @breif calculate the value that should be store in... 
+ *        -if CCP1 enabled: CCPR1L register and DC1B(two bits).
+ *        -if CCP2 enabled: CCPR2L register and DC2B(two bits).
+ *        integer only, with the per-percent scale cached at CCP_Init.
+ * @param duty hold the duty cycle in percents(0 - 100).
+ * @param ccp_obj pointer points to ccp_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_SetDuty(const ccp_t *ccp_obj , const uint8 duty)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode) ||
+       (duty > CCP_PWM_DUTY_PERCENT_MAX) || (0 == ccp_pwm_period_counts))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Rounded to the nearest count*/
+        CCP_PWM_WriteDuty(ccp_obj -> ccp_inst , (uint16)(((duty * ccp_pwm_percent_scale) + 0x8000UL) >> 16));
+    }
+    return ret;
+}
+
+/**
+ * @breif write the duty in timer counts(10-bit resolution at PR2 = 255),
+ *        counts above 4 * (PR2 + 1) keep the output high.
+ * @param ccp_obj pointer points to ccp_t data.
+ * @param duty_counts 0 - 1023, see CCP_PWM_GetPeriodCounts for 100%.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_SetDutyRaw(const ccp_t *ccp_obj , uint16 duty_counts)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode) ||
+       (duty_counts > CCP_PWM_DUTY_RAW_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CCP_PWM_WriteDuty(ccp_obj -> ccp_inst , duty_counts);
+    }
+    return ret;
+}
+
+/**
+ * @breif write the duty as a Q16 fraction of the period(duty_fraction / 65536),
+ *        CCP_PWM_DUTY_Q16_FULL gives 100%.
+ * @param ccp_obj pointer points to ccp_t data.
+ * @param duty_fraction 0x0000 - 0xFFFF.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_SetDutyQ16(const ccp_t *ccp_obj , uint16 duty_fraction)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode) || (0 == ccp_pwm_period_counts))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        CCP_PWM_WriteDuty(ccp_obj -> ccp_inst , CCP_PWM_Q16ToCounts(duty_fraction , ccp_pwm_period_counts));
+    }
+    return ret;
+}
+
+/**
+ * @breif get the duty counts of 100% at the current PR2(4 * (PR2 + 1)).
+ * @param period_counts pointer to store the counts.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means no PWM instance is initialized.
+ */
+Std_ReturnType CCP_PWM_GetPeriodCounts(uint16 *period_counts)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == period_counts) || (0 == ccp_pwm_period_counts))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *period_counts = ccp_pwm_period_counts;
+    }
+    return ret;
+}
+
+/**
+ * @breif search the Timer2 prescaler/PR2 for a PWM frequency. The smallest prescaler that
+ *        reaches it gives the largest PR2: the finest duty and the finest frequency step.
+ *        The period is rounded to the nearest count(as the CCP_PWM_AUTO_... macros do).
+ * @param frequency the PWM frequency in Hz.
+ * @param min_resolution_bits the duty resolution the setting has to reach(0 - 10).
+ * @param timing pointer to store the setting with the achieved frequency and resolution.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means no prescaler reaches the frequency or the resolution is too low.
+ */
+Std_ReturnType CCP_PWM_SelectTiming(uint32 frequency , uint8 min_resolution_bits , ccp_pwm_timing_t *timing)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 l_period = 0;
+    uint8 l_index = 0;
+    if((NULL == timing) || (min_resolution_bits > CCP_PWM_RESOLUTION_BITS_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while((E_NOT_OK == ret) && (l_index < sizeof(ccp_pwm_prescalers)))
+        {
+            ret = CCP_PWM_PeriodCompute(frequency , ccp_pwm_prescalers[l_index] , &l_period);
+            l_index++;
+        }
+        if(E_OK == ret)
+        {
+            CCP_PWM_FillTiming(ccp_pwm_prescalers[l_index - 1] , l_period , timing);
+            if(timing -> resolution_bits < min_resolution_bits)
+            {
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @breif report the running PWM setting(PR2 and the Timer2 prescaler).
+ * @param timing pointer to store the setting with its frequency and resolution.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means no PWM instance is initialized.
+ */
+Std_ReturnType CCP_PWM_GetTiming(ccp_pwm_timing_t *timing)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_16;
+    if((NULL == timing) || (0 == ccp_pwm_period_counts))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(TIMER2_PRESCALER_DIV_BY_1 == T2CONbits.T2CKPS)
+        {
+            l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_1;
+        }
+        else if(TIMER2_PRESCALER_DIV_BY_4 == T2CONbits.T2CKPS)
+        {
+            l_prescaler = CCP_TIMER2_PRESCALER_DIV_BY_4;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        CCP_PWM_FillTiming(l_prescaler , (uint32)PR2 + 1UL , timing);
+    }
+    return ret;
+}
+
+/**
+ * @brief enable CCP PWM module.
+ * @param ccp_obj pointer points to ccp_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_Start(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_PWM_MODE);
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            CCP2CONbits.CCP2M = CCP_PWM_MODE;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief disable the whole CCP module.
+ * @param ccp_obj pointer points to ccp_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function. 
+ */
+Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            CCP1_SET_MODE(CCP_MODULE_DISABLE);
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            CCP2CONbits.CCP2M = CCP_MODULE_DISABLE;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+#if CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE
+/**
+ * @breif stage the duty of the instance in timer counts, nothing changes
+ *        on the output before CCP_PWM_CommitStaged.
+ * @param ccp_obj pointer points to ccp_t data(PWM mode).
+ * @param duty_counts 0 - 1023.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_StageDutyRaw(const ccp_t *ccp_obj , uint16 duty_counts)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_staged_bit = 0;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode) ||
+       (ccp_obj -> ccp_inst > CCP2_INST) || (duty_counts > CCP_PWM_DUTY_RAW_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*CCP1_INST = 0, CCP2_INST = 1*/
+        l_staged_bit = (uint8)(CCP_PWM_STAGED_CCP1_DUTY << ccp_obj -> ccp_inst);
+        ccp_pwm_staging.duty_value[ccp_obj -> ccp_inst] = duty_counts;
+        ccp_pwm_staging.duty_is_q16 &= (uint8)~l_staged_bit;
+        ccp_pwm_staging.staged |= l_staged_bit;
+    }
+    return ret;
+}
+
+/**
+ * @breif stage the duty of the instance as a Q16 fraction, it's converted to counts
+ *        at commit against the staged frequency(or the running one).
+ * @param ccp_obj pointer points to ccp_t data(PWM mode).
+ * @param duty_fraction 0x0000 - 0xFFFF(CCP_PWM_DUTY_Q16_FULL = 100%).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_StageDutyQ16(const ccp_t *ccp_obj , uint16 duty_fraction)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_staged_bit = 0;
+    if((NULL == ccp_obj) || (CCP_PWM_MODE_SELECT != ccp_obj -> CCP_mode) || (ccp_obj -> ccp_inst > CCP2_INST))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_staged_bit = (uint8)(CCP_PWM_STAGED_CCP1_DUTY << ccp_obj -> ccp_inst);
+        ccp_pwm_staging.duty_value[ccp_obj -> ccp_inst] = duty_fraction;
+        ccp_pwm_staging.duty_is_q16 |= l_staged_bit;
+        ccp_pwm_staging.staged |= l_staged_bit;
+    }
+    return ret;
+}
+
+/**
+ * @breif stage a new PWM frequency for both instances(PR2 and the Timer2 prescaler),
+ *        the register values are calculated here so the ISR only copies them.
+ * @param frequency the PWM frequency in Hz.
+ * @param prescaler_value @ref CCP_TIMER2_PRESCALER_DIV_BY_1 ... or CCP_TIMER2_PRESCALER_AUTO.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the frequency can't be reached with this prescaler.
+ */
+Std_ReturnType CCP_PWM_StageFrequency(uint32 frequency , uint8 prescaler_value)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_period = 0;
+    uint8 l_prescaler_bits = 0;
+    ccp_pwm_timing_t l_timing;
+    if(CCP_TIMER2_PRESCALER_AUTO == prescaler_value)
+    {
+        ret = CCP_PWM_SelectTiming(frequency , 0 , &l_timing);
+        if(E_OK == ret)
+        {
+            prescaler_value = l_timing.prescaler_value;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(E_OK == ret)
+    {
+        ret = CCP_PWM_PrescalerBits(prescaler_value , &l_prescaler_bits);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(E_OK == ret)
+    {
+        ret = CCP_PWM_PeriodCompute(frequency , prescaler_value , &l_period);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(E_OK == ret)
+    {
+        ccp_pwm_staging.pr2_value = (uint8)(l_period - 1);
+        ccp_pwm_staging.prescaler_bits = l_prescaler_bits;
+        ccp_pwm_staging.period_counts = (uint16)(l_period << 2);
+        ccp_pwm_staging.percent_scale = ((uint32)ccp_pwm_staging.period_counts << 16) / CCP_PWM_DUTY_PERCENT_MAX;
+        ccp_pwm_staging.staged |= CCP_PWM_STAGED_FREQUENCY;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+/**
+ * @breif hand the staged values to the Timer2 ISR. The duties are written after the next
+ *        period match and latched by the hardware at the boundary after it, PR2 isn't
+ *        buffered so a new period is written one match later, after that boundary.
+ *        CCP1, CCP2 and the period change in the same PWM period, the new period never
+ *        runs with the old duties.
+ *        Values committed again before they are applied replace the pending ones.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means nothing is staged or a Q16 duty has no period to convert against.
+ */
+Std_ReturnType CCP_PWM_CommitStaged(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_tmr2ie_status = 0;
+    uint8 l_pending = 0;
+    uint16 l_period_counts = 0;
+    uint8 l_staged_bit = 0;
+    ccp_inst l_instance = CCP1_INST;
+    if(CCP_PWM_STAGED_NONE == ccp_pwm_staging.staged)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Period for the Q16 duties: this commit, a pending commit, or the running one*/
+        l_tmr2ie_status = PIE1bits.TMR2IE;
+        TIMER2_InterruptDisable();
+        l_pending = ccp_pwm_shadow.staged;
+        l_period_counts = ccp_pwm_shadow.period_counts;
+        PIE1bits.TMR2IE = l_tmr2ie_status;
+        if(CCP_PWM_STAGED_FREQUENCY & ccp_pwm_staging.staged)
+        {
+            l_period_counts = ccp_pwm_staging.period_counts;
+        }
+        else if(0 == (CCP_PWM_STAGED_FREQUENCY & l_pending))
+        {
+            l_period_counts = ccp_pwm_period_counts;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        for(l_instance = CCP1_INST ; l_instance <= CCP2_INST ; l_instance++)
+        {
+            l_staged_bit = (uint8)(CCP_PWM_STAGED_CCP1_DUTY << l_instance);
+            if(l_staged_bit & ccp_pwm_staging.duty_is_q16)
+            {
+                ccp_pwm_staging.duty_value[l_instance] =
+                        CCP_PWM_Q16ToCounts(ccp_pwm_staging.duty_value[l_instance] , l_period_counts);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+        if((0 != ccp_pwm_staging.duty_is_q16) && (0 == l_period_counts))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            l_tmr2ie_status = PIE1bits.TMR2IE;
+            TIMER2_InterruptDisable();
+            if(CCP_PWM_STAGED_FREQUENCY & ccp_pwm_staging.staged)
+            {
+                ccp_pwm_shadow.pr2_value = ccp_pwm_staging.pr2_value;
+                ccp_pwm_shadow.prescaler_bits = ccp_pwm_staging.prescaler_bits;
+                ccp_pwm_shadow.period_counts = ccp_pwm_staging.period_counts;
+                ccp_pwm_shadow.percent_scale = ccp_pwm_staging.percent_scale;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(CCP_PWM_STAGED_CCP1_DUTY & ccp_pwm_staging.staged)
+            {
+                ccp_pwm_shadow.duty_value[CCP1_INST] = ccp_pwm_staging.duty_value[CCP1_INST];
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            if(CCP_PWM_STAGED_CCP2_DUTY & ccp_pwm_staging.staged)
+            {
+                ccp_pwm_shadow.duty_value[CCP2_INST] = ccp_pwm_staging.duty_value[CCP2_INST];
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            ccp_pwm_shadow.staged |= ccp_pwm_staging.staged;
+            PIE1bits.TMR2IE = l_tmr2ie_status;
+        }
+        ccp_pwm_staging.staged = CCP_PWM_STAGED_NONE;
+        ccp_pwm_staging.duty_is_q16 = 0;
+    }
+    return ret;
+}
+
+/**
+ * @breif check if committed values are still waiting for the Timer2 period match.
+ * @param update_status pointer to store CCP_PWM_UPDATE_PENDING or CCP_PWM_UPDATE_DONE.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_PWM_IsUpdatePending(uint8 *update_status)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == update_status)
+    {
+        ret = E_NOT_OK;
+    }
+    else if(CCP_PWM_STAGED_NONE == ccp_pwm_shadow.staged)
+    {
+        *update_status = CCP_PWM_UPDATE_DONE;
+    }
+    else
+    {
+        *update_status = CCP_PWM_UPDATE_PENDING;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @breif check the CCPxIF of the instance if (CCPxIF = 1): CCPxIF = 0.
+ * @param ccp_obj pointer points to ccp_t data(compare mode).
+ * @param compare_status pointer to store CCPxIF status.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function or the CCPxM bits
+ *                     of the instance aren't a compare mode(the flag is left untouched).
+ */
+Std_ReturnType CCP_IsCompareComplete(const ccp_t *ccp_obj , uint8 *compare_status)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (NULL == compare_status) || (CCP_COMPARE_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_ReadEventFlag(ccp_obj , compare_status);
+    }
+    return ret;
+}
+
+/**
+ * @brief write the desired value in CCPR1H and CCPR1L;
+ * @param compare_value hold the desired value.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_CompareModeSetValue(const ccp_t *ccp_obj ,uint16 compare_value)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_reg_t capture_temp_value ={.ccpr_low = 0 , .ccpr_high = 0};
+    capture_temp_value.ccpr_16bit = compare_value;
+    if((NULL == ccp_obj) || (CCP_COMPARE_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            CCPR1L = capture_temp_value.ccpr_low;
+            CCPR1H = capture_temp_value.ccpr_high;
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            CCPR2L = capture_temp_value.ccpr_low;
+            CCPR2H = capture_temp_value.ccpr_high;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @breif check the CCPxIF of the instance if (CCPxIF = 1): CCPxIF = 0.
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param capture_status pointer to store CCPxIF status.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function or the CCPxM bits
+ *                     of the instance aren't a capture mode(the flag is left untouched).
+ */
+Std_ReturnType CCP_IsCaptureReady(const ccp_t *ccp_obj , uint8 *capture_status)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == ccp_obj) || (NULL == capture_status) || (CCP_CAPTURE_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = CCP_ReadEventFlag(ccp_obj , capture_status);
+    }
+    return ret;
+}
+
+/**
+ * @breif read and store CCPRxH + CCPRxL of the instance in a pointer variable.
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param capture_value pointer to store CCPRxH + CCPRxL.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType CCP_CaptureModeReadValue(const ccp_t *ccp_obj , uint16 *capture_value)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_reg_t capture_temp_value ={.ccpr_low = 0 , .ccpr_high = 0};
+    if((NULL == ccp_obj) || (NULL == capture_value) || (CCP_CAPTURE_MODE_SELECT != ccp_obj -> CCP_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            capture_temp_value.ccpr_low = CCPR1L;
+            capture_temp_value.ccpr_high = CCPR1H;
+        }
+        else if(CCP2_INST == ccp_obj -> ccp_inst)
+        {
+            capture_temp_value.ccpr_low = CCPR2L;
+            capture_temp_value.ccpr_high = CCPR2H;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+        *capture_value = capture_temp_value.ccpr_16bit;
+    }
+    return ret;
+}
+
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+/**
+ * @breif read the 32-bit timestamp of the last period edge, CCPRx extended with
+ *        the overflows of the capture timer(Timer1/Timer3 selected by ccp_capture_timer).
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param capture_value pointer to store the timestamp in capture timer ticks.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error or no edge is captured yet.
+ */
+Std_ReturnType CCP_CaptureModeReadExtendedValue(const ccp_t *ccp_obj , uint32 *capture_value)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_capture_meter_t l_meter;
+    ret = CCP_Capture_ReadMeter(ccp_obj , &l_meter);
+    if((E_NOT_OK == ret) || (NULL == capture_value) || (0 == (CCP_CAPTURE_METER_REFERENCE & l_meter.status)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *capture_value = l_meter.reference_edge;
+    }
+    return ret;
+}
+
+/**
+ * @breif get the signal period between the last two period edges, in the 4x and 16x
+ *        modes it's averaged over 4/16 periods.
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param period_us pointer to store the period in microseconds.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error or no period is measured yet.
+ */
+Std_ReturnType CCP_CaptureModeGetPeriod(const ccp_t *ccp_obj , uint32 *period_us)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_capture_meter_t l_meter;
+    ret = CCP_Capture_ReadMeter(ccp_obj , &l_meter);
+    if((E_NOT_OK == ret) || (NULL == period_us) || (0 == (CCP_CAPTURE_METER_PERIOD & l_meter.status)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *period_us = CCP_Capture_Divide(l_meter.period_ticks ,
+                                        CCP_Capture_TickFrequency(ccp_obj -> ccp_inst) * l_meter.edges_per_period , 6);
+    }
+    return ret;
+}
+
+/**
+ * @breif get the signal frequency of the last measured period.
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param frequency_mhz pointer to store the frequency in mHz(100 kHz = 100000000).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error or no period is measured yet.
+ */
+Std_ReturnType CCP_CaptureModeGetFrequency(const ccp_t *ccp_obj , uint32 *frequency_mhz)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_capture_meter_t l_meter;
+    ret = CCP_Capture_ReadMeter(ccp_obj , &l_meter);
+    if((E_NOT_OK == ret) || (NULL == frequency_mhz) || (0 == (CCP_CAPTURE_METER_PERIOD & l_meter.status)) ||
+       (0 == l_meter.period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *frequency_mhz = CCP_Capture_Divide(CCP_Capture_TickFrequency(ccp_obj -> ccp_inst) * l_meter.edges_per_period ,
+                                            l_meter.period_ticks , 3);
+    }
+    return ret;
+}
+
+/**
+ * @breif get the high time of the signal relative to its period, 1x modes only
+ *        (the prescaled modes don't see the opposite edge).
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ * @param duty_permille pointer to store the duty(0 - 1000).
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error or no duty is measured yet.
+ */
+Std_ReturnType CCP_CaptureModeGetDuty(const ccp_t *ccp_obj , uint16 *duty_permille)
+{
+    Std_ReturnType ret = E_OK;
+    ccp_capture_meter_t l_meter;
+    uint32 l_duty = 0;
+    ret = CCP_Capture_ReadMeter(ccp_obj , &l_meter);
+    if((E_NOT_OK == ret) || (NULL == duty_permille) || (1 != l_meter.edges_per_period) ||
+       (0 == (CCP_CAPTURE_METER_PERIOD & l_meter.status)) || (0 == (CCP_CAPTURE_METER_DUTY & l_meter.status)) ||
+       (0 == l_meter.period_ticks))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_duty = CCP_Capture_Divide(l_meter.active_ticks , l_meter.period_ticks , 3);
+        if(l_duty > CCP_CAPTURE_DUTY_PERMILLE_MAX)
+        {
+            l_duty = CCP_CAPTURE_DUTY_PERMILLE_MAX;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        /*Measured from the falling edge: that's the low time*/
+        if(CCP_CAPTURE_MODE_1_FALLING_EDGE == l_meter.reference_mode)
+        {
+            l_duty = CCP_CAPTURE_DUTY_PERMILLE_MAX - l_duty;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        *duty_permille = (uint16)l_duty;
+    }
+    return ret;
+}
+#endif
+
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+void CCP1_ISR(void)
+{
+    CCP1_InterruptFlagClear();
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+    if(0 != ccp_capture_meter[CCP1_INST].edges_per_period)
+    {
+        CCP_Capture_MeterUpdate(CCP1_INST);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#endif
+    if(CCP1_InterruptHandler)
+    {
+        CCP1_InterruptHandler();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+#endif
+
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+void CCP2_ISR(void)
+{
+    CCP2_InterruptFlagClear();
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+    if(0 != ccp_capture_meter[CCP2_INST].edges_per_period)
+    {
+        CCP_Capture_MeterUpdate(CCP2_INST);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#endif
+    if(CCP2_InterruptHandler)
+    {
+        CCP2_InterruptHandler();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+#endif
+
+/**
+ * @breif configure the interrupt of the initialized instance only(CCP1 or CCP2),
+ *        it stays disabled when the instance has no handler(and no capture meter).
+ * @param ccp_obj pointer points to ccp_t data.
+ */
+static void CCP_InterruptConfig(const ccp_t *ccp_obj)
+{
+    if(CCP1_INST == ccp_obj -> ccp_inst)
+    {
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        CCP1_InterruptDisable();
+        CCP1_InterruptFlagClear();
+        CCP1_InterruptHandler = ccp_obj -> CCP_InterruptHandler;
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+        if((NULL != CCP1_InterruptHandler) || (0 != ccp_capture_meter[CCP1_INST].edges_per_period))
+#else
+        if(NULL != CCP1_InterruptHandler)
+#endif
+        {
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == ccp_obj -> priority)
+            {
+                INTERRUPT_GlobalInterruptHighEnable();
+                CCP1_HighPrioritySet();
+            }
+            else if(INTERRUPT_LOW_PRIORITY == ccp_obj -> priority)
+            {
+                INTERRUPT_GlobalInterruptLowEnable();
+                CCP1_LowPrioritySet();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#else
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
+#endif
+            CCP1_InterruptEnable();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+    }
+    else if(CCP2_INST == ccp_obj -> ccp_inst)
+    {
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        CCP2_InterruptDisable();
+        CCP2_InterruptFlagClear();
+        CCP2_InterruptHandler = ccp_obj -> CCP_InterruptHandler;
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+        if((NULL != CCP2_InterruptHandler) || (0 != ccp_capture_meter[CCP2_INST].edges_per_period))
+#else
+        if(NULL != CCP2_InterruptHandler)
+#endif
+        {
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == ccp_obj -> priority)
+            {
+                INTERRUPT_GlobalInterruptHighEnable();
+                CCP2_HighPrioritySet();
+            }
+            else if(INTERRUPT_LOW_PRIORITY == ccp_obj -> priority)
+            {
+                INTERRUPT_GlobalInterruptLowEnable();
+                CCP2_LowPrioritySet();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#else
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
+#endif
+            CCP2_InterruptEnable();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+/**
+ * @brief select which timer should be enabled 
+ *        according to the choosen CCP module(CCP1 or CCP2).
+ * @param ccp_obj pointer points to ccp_t data.
+ */
+static void CCP_CaptureModeTimerselect(const ccp_t *ccp_obj)
+{
+    if(CCP1_CCP2_TIMER3 == ccp_obj -> ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 0;
+        T3CONbits.T3CCP2 = 1;
+    }
+    else if(CCP1_TIMER1_CCP2_TIMER3 == ccp_obj -> ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 1;
+        T3CONbits.T3CCP2 = 0;
+    }
+    else if(CCP1_CCP2_TIMER1 == ccp_obj -> ccp_capture_timer)
+    {
+        T3CONbits.T3CCP1 = 0;
+        T3CONbits.T3CCP2 = 0;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+/**
+ * @brief report and clear the capture/compare event flag of the instance.
+ *        the CCPxM bits of the instance must hold a mode of ccp_obj -> CCP_mode,
+ *        so a flag raised in another mode isn't taken.
+ * @param ccp_obj pointer points to ccp_t data(capture or compare mode).
+ * @param event_status pointer to store CCP1_CAPTURE_READY/NOT_READY(capture) or
+ *                     CCP1_COMPARE_READY/NOT_READY(compare).
+ */
+static Std_ReturnType CCP_ReadEventFlag(const ccp_t *ccp_obj , uint8 *event_status)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_mode_bits = 0;
+    uint8 l_ready = CCP1_CAPTURE_READY;
+    if(CCP1_INST == ccp_obj -> ccp_inst)
+    {
+        l_mode_bits = CCP1_GET_MODE();
+    }
+    else if(CCP2_INST == ccp_obj -> ccp_inst)
+    {
+        l_mode_bits = CCP2_GET_MODE();
+    }
+    else
+    {
+        ret = E_NOT_OK;
+    }
+    if(CCP_CAPTURE_MODE_SELECT == ccp_obj -> CCP_mode)
+    {
+        *event_status = CCP1_CAPTURE_NOT_READY;
+        l_ready = CCP1_CAPTURE_READY;
+        if((l_mode_bits < CCP_CAPTURE_MODE_1_FALLING_EDGE) || (l_mode_bits > CCP_CAPTURE_MODE_16_RISING_EDGE))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        *event_status = CCP1_COMPARE_NOT_READY;
+        l_ready = CCP1_COMPARE_READY;
+        if((CCP_COMPARE_MODE_TOGGLE_ON_MATCH != l_mode_bits) &&
+           ((l_mode_bits < CCP_COMPARE_MODE_SET_PIN_LOW) || (l_mode_bits > CCP_COMPARE_MODE_GEN_EVENT)))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    if(E_NOT_OK == ret)
+    {
+        /*NOTHING*/
+    }
+    else if(CCP1_INST == ccp_obj -> ccp_inst)
+    {
+        if(CCP1_EVENT_FLAG())
+        {
+            *event_status = l_ready;
+            CCP1_EVENT_FLAG_CLEAR();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        if(CCP2_EVENT_FLAG())
+        {
+            *event_status = l_ready;
+            CCP2_EVENT_FLAG_CLEAR();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief set PR2 for PWM_frequency(integer math) and cache the duty scale.
+ *        PWM period = 4 * (PR2 + 1) * prescaler / Fosc, the postscaler doesn't apply.
+ *        With CCP_TIMER2_PRESCALER_AUTO the prescaler is searched and written to T2CON too.
+ * @param ccp_obj pointer points to ccp_t data.
+ * @return E_NOT_OK when the frequency(or the minimum resolution) can't be reached.
+ */
+static Std_ReturnType CCP_PWM_PeriodConfig(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_period = 0;
+    uint8 l_prescaler_bits = 0;
+    ccp_pwm_timing_t l_timing;
+    if(CCP_TIMER2_PRESCALER_AUTO == ccp_obj -> prescaler_value)
+    {
+        ret = CCP_PWM_SelectTiming(ccp_obj -> PWM_frequency , ccp_obj -> PWM_min_resolution_bits , &l_timing);
+        if(E_OK == ret)
+        {
+            ret = CCP_PWM_PrescalerBits(l_timing.prescaler_value , &l_prescaler_bits);
+            TIMER2_PRESCALER_SELECT(l_prescaler_bits);
+            l_period = (uint32)l_timing.pr2_value + 1UL;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        ret = CCP_PWM_PeriodCompute(ccp_obj -> PWM_frequency , ccp_obj -> prescaler_value , &l_period);
+    }
+    if(E_OK == ret)
+    {
+        PR2 = (uint8)(l_period - 1);
+        ccp_pwm_period_counts = (uint16)(l_period << 2);
+        ccp_pwm_percent_scale = ((uint32)ccp_pwm_period_counts << 16) / CCP_PWM_DUTY_PERCENT_MAX;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+/**
+ * @brief PR2 + 1 for the frequency rounded to the nearest count, E_NOT_OK when it is outside 1 - 256.
+ */
+static Std_ReturnType CCP_PWM_PeriodCompute(uint32 frequency , uint8 prescaler_value , uint32 *period)
+{
+    Std_ReturnType ret = E_OK;
+    if((0 == frequency) || (0 == prescaler_value))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *period = (((_XTAL_FREQ / 4UL) / prescaler_value) + (frequency / 2UL)) / frequency;
+        if((0 == *period) || (*period > CCP_PWM_PERIOD_MAX))
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/*T2CKPS value of a Timer2 prescaler*/
+static Std_ReturnType CCP_PWM_PrescalerBits(uint8 prescaler_value , uint8 *prescaler_bits)
+{
+    Std_ReturnType ret = E_OK;
+    switch(prescaler_value)
+    {
+        case CCP_TIMER2_PRESCALER_DIV_BY_1:
+            *prescaler_bits = TIMER2_PRESCALER_DIV_BY_1;
+            break;
+        case CCP_TIMER2_PRESCALER_DIV_BY_4:
+            *prescaler_bits = TIMER2_PRESCALER_DIV_BY_4;
+            break;
+        case CCP_TIMER2_PRESCALER_DIV_BY_16:
+            *prescaler_bits = TIMER2_PRESCALER_DIV_BY_16;
+            break;
+        default:
+            ret = E_NOT_OK;
+            break;
+    }
+    return ret;
+}
+
+/*Setting of prescaler_value and period(PR2 + 1) with the frequency and resolution it gives*/
+static void CCP_PWM_FillTiming(uint8 prescaler_value , uint32 period , ccp_pwm_timing_t *timing)
+{
+    timing -> prescaler_value = prescaler_value;
+    timing -> pr2_value = (uint8)(period - 1);
+    timing -> period_counts = (uint16)(period << 2);
+    timing -> frequency = (((_XTAL_FREQ / 4UL) / prescaler_value) + (period / 2UL)) / period;
+    timing -> resolution_bits = 0;
+    while((2UL << timing -> resolution_bits) <= timing -> period_counts)
+    {
+        timing -> resolution_bits++;
+    }
+}
+
+/*CCP_PWM_DUTY_Q16_FULL is taken as the whole period*/
+static uint16 CCP_PWM_Q16ToCounts(uint16 duty_fraction , uint16 period_counts)
+{
+    uint16 l_duty_counts = period_counts;
+    if(CCP_PWM_DUTY_Q16_FULL != duty_fraction)
+    {
+        l_duty_counts = (uint16)(((uint32)duty_fraction * period_counts) >> 16);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return l_duty_counts;
+}
+
+#if CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE
+/**
+ * @brief Timer2 period match hook(ISR context), two phases when the frequency changes:
+ *        match N  : the duties are written, the hardware latches them at the next boundary.
+ *        match N+1: PR2/T2CKPS are written early in the period that starts with the new
+ *                   duties(PR2 acts at once, it isn't latched like the duties).
+ *        A PR2 lower than the running TMR2 would let the timer run through 255,
+ *        then the period waits for the next match.
+ *        The hook runs once per TMR2IF: with a Timer2 postscaler above 1:1 the phases are
+ *        that many periods apart, keep it at 1:1 when frequencies are staged.
+ */
+static void CCP_PWM_ApplyStaged(void)
+{
+    uint8 l_pr2_value = PR2;
+    uint8 l_write_period = 0;
+    if((CCP_PWM_STAGED_FREQUENCY & ccp_pwm_shadow.staged) &&
+       (0 == ((CCP_PWM_STAGED_CCP1_DUTY | CCP_PWM_STAGED_CCP2_DUTY) & ccp_pwm_shadow.staged)))
+    {
+        l_pr2_value = ccp_pwm_shadow.pr2_value;
+        l_write_period = 1;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if((CCP_PWM_STAGED_NONE != ccp_pwm_shadow.staged) && (TMR2 <= l_pr2_value))
+    {
+        if(1 == l_write_period)
+        {
+            PR2 = l_pr2_value;
+            /*A T2CON write clears the prescaler counter, only touch it on a change*/
+            if(T2CONbits.T2CKPS != ccp_pwm_shadow.prescaler_bits)
+            {
+                TIMER2_PRESCALER_SELECT(ccp_pwm_shadow.prescaler_bits);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            ccp_pwm_period_counts = ccp_pwm_shadow.period_counts;
+            ccp_pwm_percent_scale = ccp_pwm_shadow.percent_scale;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(CCP_PWM_STAGED_CCP1_DUTY & ccp_pwm_shadow.staged)
+        {
+            CCP_PWM_WriteDuty(CCP1_INST , ccp_pwm_shadow.duty_value[CCP1_INST]);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(CCP_PWM_STAGED_CCP2_DUTY & ccp_pwm_shadow.staged)
+        {
+            CCP_PWM_WriteDuty(CCP2_INST , ccp_pwm_shadow.duty_value[CCP2_INST]);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(1 == l_write_period)
+        {
+            ccp_pwm_shadow.staged = CCP_PWM_STAGED_NONE;
+        }
+        else
+        {
+            /*A staged frequency follows at the next match*/
+            ccp_pwm_shadow.staged &= CCP_PWM_STAGED_FREQUENCY;
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+#endif
+
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+/**
+ * @brief arm the meter of the instance and count the overflows of its capture timer.
+ *        The timer has to run free(preload 0) with its interrupt enabled.
+ * @param ccp_obj pointer points to ccp_t data(capture mode).
+ */
+static Std_ReturnType CCP_Capture_MeterStart(const ccp_t *ccp_obj)
+{
+    Std_ReturnType ret = E_OK;
+    volatile ccp_capture_meter_t *l_meter = &ccp_capture_meter[ccp_obj -> ccp_inst];
+    l_meter -> status = CCP_CAPTURE_METER_IDLE;
+    l_meter -> reference_mode = ccp_obj -> CCP_mode_variant;
+    switch(ccp_obj -> CCP_mode_variant)
+    {
+        case CCP_CAPTURE_MODE_4_RISING_EDGE:
+            l_meter -> edges_per_period = 4;
+            break;
+        case CCP_CAPTURE_MODE_16_RISING_EDGE:
+            l_meter -> edges_per_period = 16;
+            break;
+        default:
+            l_meter -> edges_per_period = 1;
+            break;
+    }
+    if(CCP_Capture_UsesTimer3(ccp_obj -> ccp_inst))
+    {
+        ret = Timer3_Set_Overflow_Hook(CCP_Capture_Timer3Overflow);
+    }
+    else
+    {
+        ret = Timer1_Set_Overflow_Hook(CCP_Capture_Timer1Overflow);
+    }
+    return ret;
+}
+
+/**
+ * @brief CCP ISR part of the meter: period on the period edges, active time on the
+ *        opposite edge, the 1x modes switch the capture edge after every capture.
+ * @param instance CCP1_INST or CCP2_INST.
+ */
+static void CCP_Capture_MeterUpdate(ccp_inst instance)
+{
+    ccp_reg_t l_capture = {.ccpr_low = 0 , .ccpr_high = 0};
+    volatile ccp_capture_meter_t *l_meter = &ccp_capture_meter[instance];
+    uint32 l_timestamp = 0;
+    if(CCP1_INST == instance)
+    {
+        l_capture.ccpr_low = CCPR1L;
+        l_capture.ccpr_high = CCPR1H;
+    }
+    else
+    {
+        l_capture.ccpr_low = CCPR2L;
+        l_capture.ccpr_high = CCPR2H;
+    }
+    l_timestamp = CCP_Capture_Extend(instance , l_capture.ccpr_16bit);
+    if(CCP_CAPTURE_METER_OPPOSITE_EDGE & l_meter -> status)
+    {
+        l_meter -> active_ticks = l_timestamp - l_meter -> reference_edge;
+        l_meter -> status = (uint8)((l_meter -> status & ~CCP_CAPTURE_METER_OPPOSITE_EDGE) | CCP_CAPTURE_METER_DUTY);
+        CCP_Capture_SetEdge(instance , l_meter -> reference_mode);
+    }
+    else
+    {
+        if(CCP_CAPTURE_METER_REFERENCE & l_meter -> status)
+        {
+            /*Unsigned difference, right across the 32-bit wrap as well*/
+            l_meter -> period_ticks = l_timestamp - l_meter -> reference_edge;
+            l_meter -> status |= CCP_CAPTURE_METER_PERIOD;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        l_meter -> reference_edge = l_timestamp;
+        l_meter -> status |= CCP_CAPTURE_METER_REFERENCE;
+        if(1 == l_meter -> edges_per_period)
+        {
+            l_meter -> status |= CCP_CAPTURE_METER_OPPOSITE_EDGE;
+            if(CCP_CAPTURE_MODE_1_RISING_EDGE == l_meter -> reference_mode)
+            {
+                CCP_Capture_SetEdge(instance , CCP_CAPTURE_MODE_1_FALLING_EDGE);
+            }
+            else
+            {
+                CCP_Capture_SetEdge(instance , CCP_CAPTURE_MODE_1_RISING_EDGE);
+            }
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+}
+
+/**
+ * @brief extend a capture to 32 bits. The capture and the timer overflow race: the overflow
+ *        may be pending(TMRxIF set, not counted yet) or already counted although the capture
+ *        came before it. Both are resolved against the running timer value, so the CCP ISR
+ *        must run within half a timer turn(32768 ticks) of the capture.
+ * @param instance CCP1_INST or CCP2_INST.
+ * @param capture_value CCPRxH:CCPRxL.
+ * @return the timestamp.
+ */
+static uint32 CCP_Capture_Extend(ccp_inst instance , uint16 capture_value)
+{
+    uint16 l_now = 0;
+    uint16 l_overflows = 0;
+    uint8 l_overflow_pending = 0;
+    uint8 l_tmrie_status = 0;
+    if(CCP_Capture_UsesTimer3(instance))
+    {
+        l_tmrie_status = PIE2bits.TMR3IE;
+        TIMER3_InterruptDisable();
+        l_now = TMR3L;/*Latches TMR3H in 16-bit mode*/
+        l_now |= (uint16)TMR3H << 8;
+        l_overflow_pending = PIR2bits.TMR3IF;
+        l_overflows = ccp_capture_timer3_overflows;
+        PIE2bits.TMR3IE = l_tmrie_status;
+    }
+    else
+    {
+        l_tmrie_status = PIE1bits.TMR1IE;
+        TIMER1_InterruptDisable();
+        l_now = TMR1L;/*Latches TMR1H in 16-bit mode*/
+        l_now |= (uint16)TMR1H << 8;
+        l_overflow_pending = PIR1bits.TMR1IF;
+        l_overflows = ccp_capture_timer1_overflows;
+        PIE1bits.TMR1IE = l_tmrie_status;
+    }
+    /*A pending overflow seen with a high timer value came after the timer was read*/
+    if((0 != l_overflow_pending) && (l_now < 0x8000U))
+    {
+        l_overflows++;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    /*Captured before the last overflow*/
+    if(capture_value > l_now)
+    {
+        l_overflows--;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ((uint32)l_overflows << 16) | capture_value;
+}
+
+/**
+ * @brief the capture timer of the instance from T3CCP2:T3CCP1(shared by CCP1 and CCP2).
+ * @return 1 for Timer3, 0 for Timer1.
+ */
+static uint8 CCP_Capture_UsesTimer3(ccp_inst instance)
+{
+    uint8 l_timer3 = 0;
+    if(1 == T3CONbits.T3CCP2)
+    {
+        l_timer3 = 1;
+    }
+    else if((1 == T3CONbits.T3CCP1) && (CCP2_INST == instance))
+    {
+        l_timer3 = 1;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return l_timer3;
+}
+
+/*Ticks per second of the capture timer(internal clock: Fosc / 4 / prescaler)*/
+static uint32 CCP_Capture_TickFrequency(ccp_inst instance)
+{
+    uint32 l_frequency = _XTAL_FREQ / 4UL;
+    if(CCP_Capture_UsesTimer3(instance))
+    {
+        l_frequency >>= T3CONbits.T3CKPS;
+    }
+    else
+    {
+        l_frequency >>= T1CONbits.T1CKPS;
+    }
+    return l_frequency;
+}
+
+/*A capture mode change can raise a false capture, the interrupt is held off around it*/
+static void CCP_Capture_SetEdge(ccp_inst instance , uint8 capture_mode)
+{
+    if(CCP1_INST == instance)
+    {
+        CCP1_InterruptDisable();
+        CCP1_SET_MODE(capture_mode);
+        CCP1_InterruptFlagClear();
+        CCP1_InterruptEnable();
+    }
+    else
+    {
+        CCP2_InterruptDisable();
+        CCP2_SET_MODE(capture_mode);
+        CCP2_InterruptFlagClear();
+        CCP2_InterruptEnable();
+    }
+}
+
+/**
+ * @brief copy the meter of the instance with its CCP interrupt held off.
+ * @return E_NOT_OK when the instance isn't a running capture meter.
+ */
+static Std_ReturnType CCP_Capture_ReadMeter(const ccp_t *ccp_obj , ccp_capture_meter_t *meter)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_ccpie_status = 0;
+    if((NULL == ccp_obj) || (CCP_CAPTURE_MODE_SELECT != ccp_obj -> CCP_mode) || (ccp_obj -> ccp_inst > CCP2_INST))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            l_ccpie_status = PIE1bits.CCP1IE;
+            CCP1_InterruptDisable();
+        }
+        else
+        {
+            l_ccpie_status = PIE2bits.CCP2IE;
+            CCP2_InterruptDisable();
+        }
+        meter -> reference_edge = ccp_capture_meter[ccp_obj -> ccp_inst].reference_edge;
+        meter -> period_ticks = ccp_capture_meter[ccp_obj -> ccp_inst].period_ticks;
+        meter -> active_ticks = ccp_capture_meter[ccp_obj -> ccp_inst].active_ticks;
+        meter -> edges_per_period = ccp_capture_meter[ccp_obj -> ccp_inst].edges_per_period;
+        meter -> reference_mode = ccp_capture_meter[ccp_obj -> ccp_inst].reference_mode;
+        meter -> status = ccp_capture_meter[ccp_obj -> ccp_inst].status;
+        if(CCP1_INST == ccp_obj -> ccp_inst)
+        {
+            PIE1bits.CCP1IE = l_ccpie_status;
+        }
+        else
+        {
+            PIE2bits.CCP2IE = l_ccpie_status;
+        }
+        if(0 == meter -> edges_per_period)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    return ret;
+}
+
+/*numerator * 10^decimal_digits / denominator by long division(no 64-bit math), the result must fit 32 bits*/
+static uint32 CCP_Capture_Divide(uint32 numerator , uint32 denominator , uint8 decimal_digits)
+{
+    uint32 l_quotient = numerator / denominator;
+    uint32 l_remainder = numerator % denominator;
+    while(decimal_digits > 0)
+    {
+        l_remainder *= 10UL;
+        l_quotient = (l_quotient * 10UL) + (l_remainder / denominator);
+        l_remainder %= denominator;
+        decimal_digits--;
+    }
+    return l_quotient;
+}
+
+static void CCP_Capture_Timer1Overflow(void)
+{
+    ccp_capture_timer1_overflows++;
+}
+
+static void CCP_Capture_Timer3Overflow(void)
+{
+    ccp_capture_timer3_overflows++;
+}
+#endif
+
+/*Both parts are latched at the next period start*/
+static void CCP_PWM_WriteDuty(ccp_inst instance , uint16 duty_counts)
+{
+    /*At PR2 = 255 100% needs 1024 counts, the 10-bit register tops out at 99.9%*/
+    if(duty_counts > CCP_PWM_DUTY_RAW_MAX)
+    {
+        duty_counts = CCP_PWM_DUTY_RAW_MAX;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(CCP1_INST == instance)
+    {
+        CCP1CONbits.DC1B = (uint8)(duty_counts & 0x03);
+        CCPR1L = (uint8)(duty_counts >> 2);
+    }
+    else if(CCP2_INST == instance)
+    {
+        CCP2CONbits.DC2B = (uint8)(duty_counts & 0x03);
+        CCPR2L = (uint8)(duty_counts >> 2);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
@@ -1,132 +1,221 @@
-/* 
- * File:   hal_ccp1.h
- * Author: Yousab Gamal
- * Created on March 31, 2025, 4:42 PM
- */
-
-#ifndef HAL_CCP1_H
-#define	HAL_CCP1_H
-
-/******************Section: Includes**********************/
-#include "ccp1_cfg.h"
-#include <xc.h>
-#include "../mcal_std_types.h"
-#include "../../MCAL_Layer/GPIO/hal_gpio.h"
-#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
-
-/******************Section: Macros Declarations***********/
-#define CCP_TIMER2_POSTSCALER_DIV_BY_1         1
-#define CCP_TIMER2_POSTSCALER_DIV_BY_2         2
-#define CCP_TIMER2_POSTSCALER_DIV_BY_3         3
-#define CCP_TIMER2_POSTSCALER_DIV_BY_4         4
-#define CCP_TIMER2_POSTSCALER_DIV_BY_5         5
-#define CCP_TIMER2_POSTSCALER_DIV_BY_6         6
-#define CCP_TIMER2_POSTSCALER_DIV_BY_7         7
-#define CCP_TIMER2_POSTSCALER_DIV_BY_8         8
-#define CCP_TIMER2_POSTSCALER_DIV_BY_9         9
-#define CCP_TIMER2_POSTSCALER_DIV_BY_10        10
-#define CCP_TIMER2_POSTSCALER_DIV_BY_11        11
-#define CCP_TIMER2_POSTSCALER_DIV_BY_12        12
-#define CCP_TIMER2_POSTSCALER_DIV_BY_13        13
-#define CCP_TIMER2_POSTSCALER_DIV_BY_14        14
-#define CCP_TIMER2_POSTSCALER_DIV_BY_15        15
-#define CCP_TIMER2_POSTSCALER_DIV_BY_16        16
-
-#define CCP_TIMER2_PRESCALER_DIV_BY_1          1
-#define CCP_TIMER2_PRESCALER_DIV_BY_4          4
-#define CCP_TIMER2_PRESCALER_DIV_BY_16         16
-
-#define CCP_MODULE_DISABLE                 ((uint8)0x00)
-#define CCP_CAPTURE_MODE_1_FALLING_EDGE    ((uint8)0x04)
-#define CCP_CAPTURE_MODE_1_RISING_EDGE     ((uint8)0x05)
-#define CCP_CAPTURE_MODE_4_RISING_EDGE     ((uint8)0x06)
-#define CCP_CAPTURE_MODE_16_RISING_EDGE    ((uint8)0x07)
-#define CCP_COMPARE_MODE_SET_PIN_LOW       ((uint8)0x08)
-#define CCP_COMPARE_MODE_SET_PIN_HIGH      ((uint8)0x09)
-#define CCP_COMPARE_MODE_TOGGLE_ON_MATCH   ((uint8)0x02)
-#define CCP_COMPARE_MODE_GEN_SW_INTERRUPT  ((uint8)0x0A)
-#define CCP_COMPARE_MODE_GEN_EVENT         ((uint8)0x0B)
-#define CCP_PWM_MODE                       ((uint8)0X0C)
-
-#define CCP1_CAPTURE_NOT_READY              0x00
-#define CCP1_CAPTURE_READY                  0x01
-
-#define CCP1_COMPARE_NOT_READY              0x00
-#define CCP1_COMPARE_READY                  0x01
-
-/******************Section: Macros Functions Declarations*/
-#define CCP1_SET_MODE(_CONFIG)              (CCP1CONbits.CCP1M = _CONFIG)
-#define CCP2_SET_MODE(_CONFIG)              (CCP2CONbits.CCP2M = _CONFIG)
-
-/******************Section: Data Types Declarations*******/
-typedef enum{
-    CCP_CAPTURE_MODE_SELECT = 0,
-    CCP_COMPARE_MODE_SELECT,
-    CCP_PWM_MODE_SELECT        
-}ccp1_mode_t;
-
-typedef union{
-    struct{
-        uint8 ccpr_low;
-        uint8 ccpr_high;
-    };
-    struct{
-        uint16 ccpr_16bit;
-    };
-}ccp_reg_t;
-
-typedef enum {
-    CCP1_INST,
-    CCP2_INST,        
-}ccp_inst;
-
-typedef enum {
-    CCP1_CCP2_TIMER3 = 0,
-    CCP1_TIMER1_CCP2_TIMER3,
-    CCP1_CCP2_TIMER1
-}ccp_capture_timer;
-
-typedef struct{
-#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    void(*CCP1_InterruptHandler)(void);
-    interrupt_priority_cfg ccp1_priority; 
-#endif
-    #if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    void(*CCP2_InterruptHandler)(void);
-    interrupt_priority_cfg ccp2_priority; 
-#endif
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_PWM_MODE_SELECTED
-    uint32 PWM_frequency;
-    uint8 postscaler_value     : 4;
-    uint8 prescaler_value      : 2;
-    uint8 reserved             : 2;
-#endif
-    ccp_inst ccp_inst;
-    ccp1_mode_t CCP_mode;
-    uint8 CCP_mode_variant;
-    pin_config_t pin_init;
-    ccp_capture_timer ccp_capture_timer;
-}ccp_t;
-
-/******************Section: Functions Declarations********/
-Std_ReturnType CCP_Init(const ccp_t *ccp_obj); 
-Std_ReturnType CCP_DeInit(const ccp_t *ccp_obj); 
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_PWM_MODE_SELECTED
-Std_ReturnType CCP_PWM_SetDuty(const ccp_t *ccp_obj , const uint8 duty);
-Std_ReturnType CCP_PWM_Start(const ccp_t *ccp_obj);
-Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj);
-#endif
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_COMPARE_MODE_SELECTED
-Std_ReturnType CCP_IsCompareComplete(uint8 *compare_status);
-Std_ReturnType CCP_CompareModeSetValue(const ccp_t *ccp_obj ,uint16 compare_value);
-#endif
-
-#if CCP_CFG_SELECTED_MODE == CCP_CFG_CAPTURE_MODE_SELECTED
-Std_ReturnType CCP_IsCaptureReady(uint8 *capture_status);
-Std_ReturnType CCP_CaptureModeReadValue(uint16 *capture_value);
-#endif
-
-#endif	/* HAL_CCP1_H */
-
+/* 
+ * File:   hal_ccp1.h
+ * Author: Yousab Gamal
+ * Created on March 31, 2025, 4:42 PM
+ */
+
+#ifndef HAL_CCP1_H
+#define	HAL_CCP1_H
+
+/******************Section: Includes**********************/
+#include "ccp1_cfg.h"
+#include <xc.h>
+#include "../mcal_std_types.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
+#include "../../MCAL_Layer/Timer1/hal_timer1.h"
+#include "../../MCAL_Layer/Timer2/hal_timer2.h"
+#include "../../MCAL_Layer/Timer3/hal_timer3.h"
+
+/******************Section: Macros Declarations***********/
+#define CCP_TIMER2_POSTSCALER_DIV_BY_1         1
+#define CCP_TIMER2_POSTSCALER_DIV_BY_2         2
+#define CCP_TIMER2_POSTSCALER_DIV_BY_3         3
+#define CCP_TIMER2_POSTSCALER_DIV_BY_4         4
+#define CCP_TIMER2_POSTSCALER_DIV_BY_5         5
+#define CCP_TIMER2_POSTSCALER_DIV_BY_6         6
+#define CCP_TIMER2_POSTSCALER_DIV_BY_7         7
+#define CCP_TIMER2_POSTSCALER_DIV_BY_8         8
+#define CCP_TIMER2_POSTSCALER_DIV_BY_9         9
+#define CCP_TIMER2_POSTSCALER_DIV_BY_10        10
+#define CCP_TIMER2_POSTSCALER_DIV_BY_11        11
+#define CCP_TIMER2_POSTSCALER_DIV_BY_12        12
+#define CCP_TIMER2_POSTSCALER_DIV_BY_13        13
+#define CCP_TIMER2_POSTSCALER_DIV_BY_14        14
+#define CCP_TIMER2_POSTSCALER_DIV_BY_15        15
+#define CCP_TIMER2_POSTSCALER_DIV_BY_16        16
+
+#define CCP_TIMER2_PRESCALER_DIV_BY_1          1
+#define CCP_TIMER2_PRESCALER_DIV_BY_4          4
+#define CCP_TIMER2_PRESCALER_DIV_BY_16         16
+/*PWM: the prescaler/PR2 giving the finest duty is searched for PWM_frequency.
+  Not a prescaler value, so a zeroed ccp_t is rejected instead of auto-selected*/
+#define CCP_TIMER2_PRESCALER_AUTO              0xFF
+
+#define CCP_MODULE_DISABLE                 ((uint8)0x00)
+#define CCP_CAPTURE_MODE_1_FALLING_EDGE    ((uint8)0x04)
+#define CCP_CAPTURE_MODE_1_RISING_EDGE     ((uint8)0x05)
+#define CCP_CAPTURE_MODE_4_RISING_EDGE     ((uint8)0x06)
+#define CCP_CAPTURE_MODE_16_RISING_EDGE    ((uint8)0x07)
+#define CCP_COMPARE_MODE_SET_PIN_LOW       ((uint8)0x08)
+#define CCP_COMPARE_MODE_SET_PIN_HIGH      ((uint8)0x09)
+#define CCP_COMPARE_MODE_TOGGLE_ON_MATCH   ((uint8)0x02)
+#define CCP_COMPARE_MODE_GEN_SW_INTERRUPT  ((uint8)0x0A)
+#define CCP_COMPARE_MODE_GEN_EVENT         ((uint8)0x0B)
+#define CCP_PWM_MODE                       ((uint8)0X0C)
+
+                    /*PWM duty: 10-bit counts(CCPRxL:DCxB), Q16 fraction of the period*/
+#define CCP_PWM_DUTY_RAW_MAX               1023U
+#define CCP_PWM_DUTY_Q16_FULL              0xFFFFU   /*Taken as 100%*/
+#define CCP_PWM_DUTY_PERCENT_MAX           100U
+#define CCP_PWM_PERIOD_MAX                 256UL     /*PR2 + 1*/
+#define CCP_PWM_RESOLUTION_BITS_MAX        10U
+
+#if (CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE) && \
+    (TIMER2_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE)
+#error "CCP_CFG_PWM_STAGED_UPDATE is applied from the TIMER2 interrupt"
+#endif
+                    /*Staged PWM values(CCP_PWM_Stage...), one bit per value*/
+#define CCP_PWM_STAGED_NONE                0x00U
+#define CCP_PWM_STAGED_CCP1_DUTY           0x01U
+#define CCP_PWM_STAGED_CCP2_DUTY           0x02U
+#define CCP_PWM_STAGED_FREQUENCY           0x04U
+#define CCP_PWM_UPDATE_DONE                0x00U
+#define CCP_PWM_UPDATE_PENDING             0x01U
+
+#if (CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE) && \
+    ((CCP1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE) || \
+     (CCP2_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE) || \
+     (TIMER1_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE) || \
+     (TIMER3_INTERRUPT_FEATURE_ENABLE != INTERRUPT_FEATURE_ENABLE))
+#error "CCP_CFG_CAPTURE_METER needs the CCP1, CCP2, TIMER1 and TIMER3 interrupts"
+#endif
+                    /*Capture meter results(CCP_CaptureModeGet...)*/
+#define CCP_CAPTURE_DUTY_PERMILLE_MAX      1000U
+                    /*Capture meter status bits*/
+#define CCP_CAPTURE_METER_IDLE             0x00U
+#define CCP_CAPTURE_METER_REFERENCE        0x01U   /*A period edge is captured*/
+#define CCP_CAPTURE_METER_PERIOD           0x02U   /*Period ready(two period edges)*/
+#define CCP_CAPTURE_METER_DUTY             0x04U   /*Active time ready(1x modes)*/
+#define CCP_CAPTURE_METER_OPPOSITE_EDGE    0x08U   /*Waiting for the opposite edge(1x modes)*/
+
+#define CCP1_CAPTURE_NOT_READY              0x00
+#define CCP1_CAPTURE_READY                  0x01
+
+#define CCP1_COMPARE_NOT_READY              0x00
+#define CCP1_COMPARE_READY                  0x01
+
+/******************Section: Macros Functions Declarations*/
+                    /*Compile-time form of CCP_PWM_SelectTiming for constant frequencies(usable in #if)*/
+#define CCP_PWM_PERIOD(_FREQ , _PRESCALER)    ((((_XTAL_FREQ / 4UL) / (_PRESCALER)) + ((_FREQ) / 2UL)) / (_FREQ))
+#define CCP_PWM_AUTO_PRESCALER(_FREQ)         ((CCP_PWM_PERIOD(_FREQ , 1UL) <= CCP_PWM_PERIOD_MAX) ? 1UL : \
+                                               ((CCP_PWM_PERIOD(_FREQ , 4UL) <= CCP_PWM_PERIOD_MAX) ? 4UL : 16UL))
+#define CCP_PWM_AUTO_PERIOD(_FREQ)            CCP_PWM_PERIOD(_FREQ , CCP_PWM_AUTO_PRESCALER(_FREQ))
+#define CCP_PWM_AUTO_PR2(_FREQ)               (CCP_PWM_AUTO_PERIOD(_FREQ) - 1UL)
+#define CCP_PWM_RESOLUTION_BITS(_COUNTS)      (((_COUNTS) >= 1024UL) ? 10U : ((_COUNTS) >= 512UL) ? 9U : \
+                                               ((_COUNTS) >= 256UL) ? 8U : ((_COUNTS) >= 128UL) ? 7U : \
+                                               ((_COUNTS) >= 64UL) ? 6U : ((_COUNTS) >= 32UL) ? 5U : \
+                                               ((_COUNTS) >= 16UL) ? 4U : ((_COUNTS) >= 8UL) ? 3U : 2U)
+#define CCP_PWM_AUTO_RESOLUTION_BITS(_FREQ)   CCP_PWM_RESOLUTION_BITS(4UL * CCP_PWM_AUTO_PERIOD(_FREQ))
+
+#if CCP_CFG_PWM_FREQUENCY != 0UL
+#if (CCP_PWM_AUTO_PERIOD(CCP_CFG_PWM_FREQUENCY) == 0UL) || \
+    (CCP_PWM_AUTO_PERIOD(CCP_CFG_PWM_FREQUENCY) > CCP_PWM_PERIOD_MAX)
+#error "CCP_CFG_PWM_FREQUENCY can't be generated by Timer2 from _XTAL_FREQ"
+#elif CCP_PWM_AUTO_RESOLUTION_BITS(CCP_CFG_PWM_FREQUENCY) < CCP_CFG_PWM_MIN_RESOLUTION_BITS
+#error "CCP_CFG_PWM_FREQUENCY is too high for CCP_CFG_PWM_MIN_RESOLUTION_BITS"
+#endif
+#endif
+
+#define CCP1_SET_MODE(_CONFIG)              (CCP1CONbits.CCP1M = _CONFIG)
+#define CCP2_SET_MODE(_CONFIG)              (CCP2CONbits.CCP2M = _CONFIG)
+#define CCP1_GET_MODE()                     (CCP1CONbits.CCP1M)
+#define CCP2_GET_MODE()                     (CCP2CONbits.CCP2M)
+                    /*Capture/compare event flags, also used for polling without the interrupt*/
+#define CCP1_EVENT_FLAG()                   (PIR1bits.CCP1IF)
+#define CCP2_EVENT_FLAG()                   (PIR2bits.CCP2IF)
+#define CCP1_EVENT_FLAG_CLEAR()             (PIR1bits.CCP1IF = 0)
+#define CCP2_EVENT_FLAG_CLEAR()             (PIR2bits.CCP2IF = 0)
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    CCP_CAPTURE_MODE_SELECT = 0,
+    CCP_COMPARE_MODE_SELECT,
+    CCP_PWM_MODE_SELECT        
+}ccp1_mode_t;
+
+typedef union{
+    struct{
+        uint8 ccpr_low;
+        uint8 ccpr_high;
+    };
+    struct{
+        uint16 ccpr_16bit;
+    };
+}ccp_reg_t;
+
+typedef enum {
+    CCP1_INST,
+    CCP2_INST,        
+}ccp_inst;
+
+typedef enum {
+    CCP1_CCP2_TIMER3 = 0,
+    CCP1_TIMER1_CCP2_TIMER3,
+    CCP1_CCP2_TIMER1
+}ccp_capture_timer;
+
+typedef struct{
+    uint32 frequency;                     /*Achieved PWM frequency in Hz(rounded)*/
+    uint16 period_counts;                 /*4 * (PR2 + 1): duty counts of 100%*/
+    uint8 pr2_value;
+    uint8 prescaler_value;                /*@ref CCP_TIMER2_PRESCALER_DIV_BY_1 ...*/
+    uint8 resolution_bits;                /*Duty resolution, log2(period_counts) rounded down*/
+}ccp_pwm_timing_t;
+
+/*
+ * One object per instance, CCP1 and CCP2 can run different modes at the same time.
+ * Shared hardware: both PWM instances use the Timer2 period(PR2) and both
+ * capture/compare instances use the timer selection in T3CON(last Init wins).
+ */
+typedef struct{
+#if (CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE) || \
+    (CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE)
+    void(*CCP_InterruptHandler)(void);    /*Interrupt of this instance, NULL keeps it disabled(polling)*/
+    interrupt_priority_cfg priority; 
+#endif
+    uint32 PWM_frequency;                 /*PWM mode only*/
+    uint8 PWM_min_resolution_bits;        /*PWM mode with CCP_TIMER2_PRESCALER_AUTO*/
+    uint8 postscaler_value;               /*@ref CCP_TIMER2_POSTSCALER_DIV_BY_1 ...(Timer2 interrupt rate only)*/
+    uint8 prescaler_value;                /*@ref CCP_TIMER2_PRESCALER_DIV_BY_1 ... or CCP_TIMER2_PRESCALER_AUTO*/
+    ccp_inst ccp_inst;
+    ccp1_mode_t CCP_mode;
+    uint8 CCP_mode_variant;
+    pin_config_t pin_init;
+    ccp_capture_timer ccp_capture_timer;
+}ccp_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType CCP_Init(const ccp_t *ccp_obj); 
+Std_ReturnType CCP_DeInit(const ccp_t *ccp_obj); 
+
+Std_ReturnType CCP_PWM_SetDuty(const ccp_t *ccp_obj , const uint8 duty);
+Std_ReturnType CCP_PWM_SetDutyRaw(const ccp_t *ccp_obj , uint16 duty_counts);
+Std_ReturnType CCP_PWM_SetDutyQ16(const ccp_t *ccp_obj , uint16 duty_fraction);
+Std_ReturnType CCP_PWM_GetPeriodCounts(uint16 *period_counts);
+Std_ReturnType CCP_PWM_SelectTiming(uint32 frequency , uint8 min_resolution_bits , ccp_pwm_timing_t *timing);
+Std_ReturnType CCP_PWM_GetTiming(ccp_pwm_timing_t *timing);
+Std_ReturnType CCP_PWM_Start(const ccp_t *ccp_obj);
+Std_ReturnType CCP_PWM_Stop(const ccp_t *ccp_obj);
+#if CCP_CFG_PWM_STAGED_UPDATE == CCP_CFG_FEATURE_ENABLE
+Std_ReturnType CCP_PWM_StageDutyRaw(const ccp_t *ccp_obj , uint16 duty_counts);
+Std_ReturnType CCP_PWM_StageDutyQ16(const ccp_t *ccp_obj , uint16 duty_fraction);
+Std_ReturnType CCP_PWM_StageFrequency(uint32 frequency , uint8 prescaler_value);
+Std_ReturnType CCP_PWM_CommitStaged(void);
+Std_ReturnType CCP_PWM_IsUpdatePending(uint8 *update_status);
+#endif
+
+Std_ReturnType CCP_IsCompareComplete(const ccp_t *ccp_obj , uint8 *compare_status);
+Std_ReturnType CCP_CompareModeSetValue(const ccp_t *ccp_obj ,uint16 compare_value);
+
+Std_ReturnType CCP_IsCaptureReady(const ccp_t *ccp_obj , uint8 *capture_status);
+Std_ReturnType CCP_CaptureModeReadValue(const ccp_t *ccp_obj , uint16 *capture_value);
+#if CCP_CFG_CAPTURE_METER == CCP_CFG_FEATURE_ENABLE
+Std_ReturnType CCP_CaptureModeReadExtendedValue(const ccp_t *ccp_obj , uint32 *capture_value);
+Std_ReturnType CCP_CaptureModeGetPeriod(const ccp_t *ccp_obj , uint32 *period_us);
+Std_ReturnType CCP_CaptureModeGetFrequency(const ccp_t *ccp_obj , uint32 *frequency_mhz);
+Std_ReturnType CCP_CaptureModeGetDuty(const ccp_t *ccp_obj , uint16 *duty_permille);
+#endif
+
+#endif	/* HAL_CCP1_H */
+
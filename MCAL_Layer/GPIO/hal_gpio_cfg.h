@@ -1,17 +1,17 @@
-/* 
- * File:   hal_gpio_cfg.h
- * Author: Ibrahim Shenouda
- *
- * Created on 04 ??????, 2024, 06:46 ?
- */
-
-#ifndef HAL_GPIO_CFG_H
-#define	HAL_GPIO_CFG_H
-
-
-#define CONfIG_ENABLE   0x01
-#define CONfIG_DISABLE  0x00
-
-
-#endif	/* HAL_GPIO_CFG_H */
-
+/* 
+ * File:   hal_gpio_cfg.h
+ * Author: Ibrahim Shenouda
+ *
+ * Created on 04 ??????, 2024, 06:46 ?
+ */
+
+#ifndef HAL_GPIO_CFG_H
+#define	HAL_GPIO_CFG_H
+
+
+#define CONfIG_ENABLE   0x01
+#define CONfIG_DISABLE  0x00
+
+
+#endif	/* HAL_GPIO_CFG_H */
+
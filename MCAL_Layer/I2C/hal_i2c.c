@@ -1,359 +1,1477 @@
-#include "hal_i2c.h"
-
-                    /*Static functions declaration*/
-static inline void MSSP_I2C_Mode_GPIO_CFG(void);
-static inline void I2C_Master_Mode_clock_Congigrations(const mssp_i2c_t * i2c_obj);
-static inline void I2C_Slew_Control(const mssp_i2c_t * i2c_obj);
-static inline void I2C_SMBus_Enable_Or_Disable(const mssp_i2c_t * i2c_obj);
-static inline void MSSP_I2C_Interrupt_Configrations(const mssp_i2c_t * i2c_obj);
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
-    static void(*I2C_Report_Write_Collision_InterruptHandler)(void);
-    static void(*I2C_Deafult_Interrupthandler)(void);
-    static void(*I2C_Report_Receive_Overflow_InterruptHandler)(void);
-#endif                    
-
-                    /*Other functions declaration*/
-/**
- * @brief Initialize I2C communication 
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == i2c_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        MSSP_MODULE_DISABLE_CFG();
-        if(MSSP_I2C_MASTER_MODE == i2c_obj->i2c_config.i2c_mode)
-        {
-            I2C_Master_Mode_clock_Congigrations(i2c_obj);
-        }
-        else if(MSSP_I2C_SLAVE_MODE == i2c_obj->i2c_config.i2c_mode)
-        {
-            if(I2C_GENERAL_CALL_ENABLE == i2c_obj->i2c_config.i2c_general_call)
-            {
-                I2C_GENERAL_CALL_ENABLE_CFG();
-            }
-            else if(I2C_GENERAL_CALL_DISABLE == i2c_obj->i2c_config.i2c_general_call)
-            {
-                I2C_GENERAL_CALL_DISABLE_CFG();
-            }
-            else
-            {
-                /*Nothing*/
-            }
-        }
-        else
-        {
-            /*Nothing*/
-        }
-        MSSP_I2C_Mode_GPIO_CFG();
-        I2C_Slew_Control(i2c_obj);
-        I2C_SMBus_Enable_Or_Disable(i2c_obj);
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE        
-        MSSP_I2C_Interrupt_Configrations(i2c_obj);
-#endif        
-        MSSP_MODULE_ENABLE_CFG();
-    }
-    return ret;
-}
-
-/**
- * @brief Deinitialize I2C communication 
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSP_I2C_Deinit(const mssp_i2c_t * i2c_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == i2c_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        MSSP_MODULE_DISABLE_CFG();
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
-        MSSP_I2C_InterruptDisable();
-        MSSP_I2C_BUS_COL_InterruptDisable();     
-#endif 
-    }
-    return ret;
-}
-
-/**
- * @brief Initiate the start condition on the SCL and SDA
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSP_I2C_Master_Send_Start_Blocking(const mssp_i2c_t * i2c_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == i2c_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        SSPCON2bits.SEN = 1;/*Automatically cleared by hardware*/
-        while(SSPCON2bits.SEN);/*Wait for the completion of the start condition*/
-        PIR1bits.SSPIF = 0;
-        if(I2C_START_BIT_DETECTED == SSPSTATbits.S)
-        {
-            ret = E_OK;
-        }
-        else
-        {
-            ret = E_NOT_OK;
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief Initiate repeated start condition on the SCL and SDA
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start_Blocking(const mssp_i2c_t * i2c_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == i2c_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        SSPCON2bits.RSEN = 1;/*Automatically cleared by hardware*/
-        while(SSPCON2bits.RSEN);
-        PIR1bits.SSPIF = 0;
-    }
-    return ret;
-}
-
-/**
- * @brief Initiate the stop condition on the SCL and SDA
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSP_I2C_Master_Send_Stop_Blocking(const mssp_i2c_t * i2c_obj)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == i2c_obj)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        SSPCON2bits.PEN = 1;/*Automatically cleared by hardware*/
-        while(SSPCON2bits.PEN);
-        PIR1bits.SSPIF = 0;
-        if(I2C_STOP_BIT_DETECTED == SSPSTATbits.P)
-        {
-            ret = E_OK;
-        }
-        else
-        {
-            ret = E_NOT_OK;
-        }
-    }
-    return ret;
-}
-/**
- * @brief Write a single byte of data to a specific I2C device 
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @param i2c_data : The data wrote on the bus 
- * @param ack : Pointer to get the state of received data from the slave
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if the retrieved pointer is NULL  
- */
-Std_ReturnType MSSSP_I2C_Master_Write_blocking(const mssp_i2c_t * i2c_obj , uint8 i2c_data , uint8 * ack)
-{
-    Std_ReturnType ret = E_OK;
-    if((NULL == i2c_obj) || (NULL == ack))
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        SSPBUF = i2c_data;
-        while(!PIR1bits.SSPIF);
-        PIR1bits.SSPIF = 0;
-        if(I2C_ACK_RECEIVE_FROM_SLAVE == SSPCON2bits.ACKSTAT)
-        {
-            *ack = I2C_ACK_RECEIVE_FROM_SLAVE;
-        }
-        else
-        {
-            *ack = I2C_ACK_NOT_RECEIVE_FROM_SLAVE;
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief Read a single byte of data to a specific I2C device 
- * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
- *                  that includes all the specifications of I2C mode
- * @param ack : The state that determines if data received 
- *              successfully or not
- * @param i2c_data : Pointer points to the data(uint8 type) retrieved 
- *                   from the slave 
- * @return E_OK if the function implements successfully  
- *         E_NOT_OK if any of the retrieved pointers are NULL  
- */
-Std_ReturnType MSSP_I2C_Master_Read_Blocking(const mssp_i2c_t * i2c_obj , uint8 ack , uint8 * i2c_data)
-{
-    Std_ReturnType ret = E_OK;
-    if((NULL == i2c_obj) || (NULL == i2c_data))
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        I2C_MASTER_RECEIVE_ENABLE_CFG();
-        while(!SSPSTATbits.BF);
-        *i2c_data = SSPBUF;
-        if(I2C_MASTER_SEND_ACK == ack)
-        {
-            SSPCON2bits.ACKDT = 0;
-        }
-        else if(I2C_MASTER_SEND_NOT_ACK == ack)
-        {
-            SSPCON2bits.ACKDT = 1;
-        }
-        else
-        {
-            /*Nothing*/
-        }
-        SSPCON2bits.ACKEN = 1;/*Automatically cleared by hardware*/
-    }
-    return ret;
-}
-
-void MSSP_I2C_ISR(void)
-{
-    MSSP_I2C_InterruptFlagClear();
-    if(NULL != I2C_Deafult_Interrupthandler)
-    {
-        I2C_Deafult_Interrupthandler();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-void MSSP_I2C_BUS_COL_ISR(void)
-{
-    MSSP_I2C_BUS_COL_InterruptFlagClear();
-    if(NULL != I2C_Report_Write_Collision_InterruptHandler)
-    {
-        I2C_Report_Write_Collision_InterruptHandler();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-static inline void MSSP_I2C_Mode_GPIO_CFG(void)
-{
-    TRISCbits.TRISC3 = 1;/*Serial clock (SCL) is Input*/
-    TRISCbits.TRISC4 = 1;/*Serial data (SDA) is Input*/
-}
-static inline void I2C_Master_Mode_clock_Congigrations(const mssp_i2c_t * i2c_obj)
-{
-    SSPCON1bits.SSPM = I2C_MASTER_MODE_DEFINED_CLOCK;
-    SSPADD = (uint8)(((_XTAL_FREQ / 4.0) / i2c_obj->i2c_clock) - 1);
-}
-static inline void I2C_Slew_Control(const mssp_i2c_t * i2c_obj)
-{
-    if(I2C_SLEW_RATE_ENABLE == i2c_obj->i2c_config.i2c_slew_rate)
-    {
-        I2C_SLEW_RATE_ENABLE_CFG();
-    }
-    else if(I2C_SLEW_RATE_DISABLE == i2c_obj->i2c_config.i2c_slew_rate)
-    {
-        I2C_SLEW_RATE_DISABLE_CFG();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-static inline void I2C_SMBus_Enable_Or_Disable(const mssp_i2c_t * i2c_obj)
-{
-    if(I2C_SMBUS_ENABLE == i2c_obj->i2c_config.i2c_SMBus_control)
-    {
-        I2C_SMBUS_ENABLE_CFG();
-    }
-    else if(I2C_SMBUS_DISABLE == i2c_obj->i2c_config.i2c_SMBus_control)
-    {
-        I2C_SMBUS_DISABLE_CFG();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-static inline void MSSP_I2C_Interrupt_Configrations(const mssp_i2c_t * i2c_obj)
-{
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
-        MSSP_I2C_InterruptEnable();
-        MSSP_I2C_BUS_COL_InterruptEnable();
-        MSSP_I2C_InterruptFlagClear();
-        MSSP_I2C_BUS_COL_InterruptFlagClear();
-        I2C_Report_Write_Collision_InterruptHandler = i2c_obj->I2C_Report_Write_Collision;
-        I2C_Deafult_Interrupthandler = i2c_obj->I2C_Deafult_Interrupthandler;
-        I2C_Report_Receive_Overflow_InterruptHandler = i2c_obj->I2C_Report_Receive_Overflow;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-        INTERRUPT_PriorityLevelEnable();
-        if(INTERRUPT_HIGH_PRIORITY == i2c_obj->i2c_config.mssp_i2c_priority)
-        {
-            INTERRUPT_GlobalInterruptHighEnable();
-            MSSP_I2C_HighPrioritySet();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == i2c_obj->i2c_config.mssp_i2c_priority)
-        {
-            INTERRUPT_GlobalInterruptLowEnable();
-            MSSP_I2C_LowPrioritySet();
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-        if(INTERRUPT_HIGH_PRIORITY == i2c_obj->i2c_config.mssp_i2c_bus_col_priority)
-        {
-            INTERRUPT_GlobalInterruptHighEnable();
-            MSSP_I2C_BUS_COL_HighPrioritySet();
-        }
-        else if(INTERRUPT_LOW_PRIORITY == i2c_obj->i2c_config.mssp_i2c_bus_col_priority)
-        {
-            INTERRUPT_GlobalInterruptLowEnable();
-            MSSP_I2C_BUS_COL_LowPrioritySet();
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-#else
-        INTERRUPT_GlobalInterruptEnable();
-        INTERRUPT_PeripheralInterruptEnable();
-#endif        
-#endif   
-}
-
+#include "hal_i2c.h"
+
+                    /*Bounded waits: each poll takes at least I2C_WAIT_POLL_CYCLES instruction cycles*/
+#define I2C_WAIT_POLL_CYCLES    8UL
+#define I2C_WAIT_POLLS          ((uint16)(((I2C_CFG_TIMEOUT_US * (_XTAL_FREQ / 4000UL)) / \
+                                           (1000UL * I2C_WAIT_POLL_CYCLES)) + 1UL))
+#if ((I2C_CFG_TIMEOUT_US * (_XTAL_FREQ / 4000UL)) / (1000UL * I2C_WAIT_POLL_CYCLES)) > 65534UL
+#error "I2C_CFG_TIMEOUT_US is too long for the bounded wait counter"
+#endif
+                    /*Flags polled by the blocking functions*/
+#define I2C_SSPCON2_SEN_MASK        0x01U
+#define I2C_SSPCON2_RSEN_MASK       0x02U
+#define I2C_SSPCON2_PEN_MASK        0x04U
+#define I2C_SSPCON2_RCEN_MASK       0x08U
+#define I2C_SSPCON2_ACKEN_MASK      0x10U
+#define I2C_SSPCON2_SEQUENCE_MASK   0x1FU
+#define I2C_SSPSTAT_BF_MASK         0x01U
+#define I2C_SSPSTAT_TRANSMIT_MASK   0x04U   /*R/W bit: transmit in progress(master mode)*/
+                    /*Open-drain control of the bus pins during the recovery*/
+#define I2C_SCL_DRIVE_LOW()         (TRISCbits.TRISC3 = 0)
+#define I2C_SCL_RELEASE()           (TRISCbits.TRISC3 = 1)
+#define I2C_SDA_DRIVE_LOW()         (TRISCbits.TRISC4 = 0)
+#define I2C_SDA_RELEASE()           (TRISCbits.TRISC4 = 1)
+#if I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE
+                    /*Timer1 while borrowed by the diagnostics: 16-bit read/write, Fosc/4, prescaler 1*/
+#define I2C_TIMER1_CONFIG           0x80U
+#define I2C_TIMER1_START()          (T1CONbits.TMR1ON = 1)
+#define I2C_BENCHMARK_SPEEDS        3U
+#endif
+
+                    /*Static functions declaration*/
+static inline void MSSP_I2C_Mode_GPIO_CFG(void);
+static inline Std_ReturnType I2C_Master_Mode_clock_Congigrations(const mssp_i2c_t * i2c_obj);
+static Std_ReturnType I2C_Set_Clock(uint32 clock);
+static inline void I2C_Slew_Control(const mssp_i2c_t * i2c_obj);
+static inline void I2C_SMBus_Enable_Or_Disable(const mssp_i2c_t * i2c_obj);
+static inline void MSSP_I2C_Interrupt_Configrations(const mssp_i2c_t * i2c_obj);
+static Std_ReturnType I2C_Mem_Transfer(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                       uint8 mem_address_size , const uint8 * write_data , uint8 * read_data ,
+                                       uint8 length);
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_DISABLE
+static Std_ReturnType I2C_Write_Acknowledged(const mssp_i2c_t * i2c_obj , uint8 i2c_data);
+#endif
+static Std_ReturnType I2C_Wait(volatile uint8 * reg , uint8 mask , uint8 expected);
+static Std_ReturnType I2C_Bus_Recover(void);
+#if I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE
+static Std_ReturnType I2C_Benchmark_Device(const mssp_i2c_t * i2c_obj , uint8 slave_address ,
+                                           std_format_sink_t sink , void * context);
+static void I2C_Timer_Start(void);
+static uint16 I2C_Timer_Elapsed_us(void);
+static uint16 I2C_Bus_Error_Count(void);
+
+static const uint32 i2c_benchmark_clocks[I2C_BENCHMARK_SPEEDS] = {100000UL , 400000UL , 1000000UL};
+#endif
+
+static volatile i2c_bus_statistics_t i2c_bus_statistics;
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
+    static void(*I2C_Report_Write_Collision_InterruptHandler)(void);
+    static void(*I2C_Deafult_Interrupthandler)(void);
+    static void(*I2C_Report_Receive_Overflow_InterruptHandler)(void);
+#endif                    
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+                    /*Transaction engine states(what the next SSPIF means)*/
+#define I2C_ENGINE_IDLE           0x00U
+#define I2C_ENGINE_START          0x01U
+#define I2C_ENGINE_ADDRESS_WRITE  0x02U
+#define I2C_ENGINE_WRITE          0x03U
+#define I2C_ENGINE_RESTART        0x04U
+#define I2C_ENGINE_ADDRESS_READ   0x05U
+#define I2C_ENGINE_READ           0x06U
+#define I2C_ENGINE_ACK            0x07U
+#define I2C_ENGINE_STOP           0x08U
+#define I2C_ENGINE_RECOVER        0x09U   /*Held until MSSP_I2C_Master_Service recovers the bus*/
+
+static i2c_transaction_t *i2c_queue[I2C_CFG_QUEUE_SIZE];
+static volatile uint8 i2c_queue_head = 0;
+static volatile uint8 i2c_queue_count = 0;
+static volatile uint8 i2c_engine_state = I2C_ENGINE_IDLE;
+static uint8 i2c_engine_index = 0;
+static uint8 i2c_engine_result = I2C_TRANSACTION_DONE;
+static volatile uint8 i2c_engine_events = 0;        /*Counts the bus events, the waiting side sees progress*/
+static volatile uint8 i2c_recovery_pending = 0;     /*Set by the bus collision ISR*/
+
+static void I2C_Engine_Start_Next(void);
+static void I2C_Engine_Stop(uint8 result);
+static void I2C_Engine_Complete(uint8 result);
+static void I2C_Engine_Step(void);
+static Std_ReturnType I2C_Engine_Abort(uint8 is_timeout);
+#endif
+#if I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE
+static const i2c_slave_register_file_t *i2c_slave_register_file = NULL;
+static uint8 i2c_slave_pointer = 0;
+static uint8 i2c_slave_pointer_received = 0;
+
+static void I2C_Slave_Step(void);
+static uint8 I2C_Slave_Read_Register(void);
+#endif
+
+                    /*Other functions declaration*/
+/**
+ * @brief Initialize I2C communication 
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL or the master clock needs
+ *                  SSPADD outside 3..127 at _XTAL_FREQ(the MSSP is left disabled)
+ */
+Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        MSSP_MODULE_DISABLE_CFG();
+        if(MSSP_I2C_MASTER_MODE == i2c_obj->i2c_config.i2c_mode)
+        {
+            ret = I2C_Master_Mode_clock_Congigrations(i2c_obj);
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+            i2c_queue_head = 0;
+            i2c_queue_count = 0;
+            i2c_engine_state = I2C_ENGINE_IDLE;
+#endif
+        }
+        else if(MSSP_I2C_SLAVE_MODE == i2c_obj->i2c_config.i2c_mode)
+        {
+            SSPCON1bits.SSPM = i2c_obj->i2c_config.i2c_mode_cfg;
+            SSPADD = (uint8)(i2c_obj->i2c_config.i2c_slave_address << 1);
+            SSPCON2bits.SEN = 1;/*Clock stretching: SCL is held after each received byte*/
+            SSPCON1bits.CKP = 1;
+            if(I2C_GENERAL_CALL_ENABLE == i2c_obj->i2c_config.i2c_general_call)
+            {
+                I2C_GENERAL_CALL_ENABLE_CFG();
+            }
+            else if(I2C_GENERAL_CALL_DISABLE == i2c_obj->i2c_config.i2c_general_call)
+            {
+                I2C_GENERAL_CALL_DISABLE_CFG();
+            }
+            else
+            {
+                /*Nothing*/
+            }
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        MSSP_I2C_Mode_GPIO_CFG();
+        I2C_Slew_Control(i2c_obj);
+        I2C_SMBus_Enable_Or_Disable(i2c_obj);
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE        
+        MSSP_I2C_Interrupt_Configrations(i2c_obj);
+#endif        
+        if(E_OK == ret)
+        {
+            MSSP_MODULE_ENABLE_CFG();
+        }
+        else
+        {
+            /*Nothing*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Deinitialize I2C communication 
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSP_I2C_Deinit(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        MSSP_MODULE_DISABLE_CFG();
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
+        MSSP_I2C_InterruptDisable();
+        MSSP_I2C_BUS_COL_InterruptDisable();     
+#endif 
+    }
+    return ret;
+}
+
+/**
+ * @brief Initiate the start condition on the SCL and SDA
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSP_I2C_Master_Send_Start_Blocking(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+    else if(I2C_ENGINE_IDLE != i2c_engine_state)
+    {
+        ret = E_NOT_OK;/*The bus is owned by a queued transaction*/
+    }
+#endif
+    else
+    {
+        SSPCON2bits.SEN = 1;/*Automatically cleared by hardware*/
+        ret = I2C_Wait(&SSPCON2 , I2C_SSPCON2_SEN_MASK , 0);/*Wait for the completion of the start condition*/
+        PIR1bits.SSPIF = 0;
+        if((E_OK == ret) && (I2C_START_BIT_DETECTED == SSPSTATbits.S))
+        {
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Initiate repeated start condition on the SCL and SDA
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start_Blocking(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SSPCON2bits.RSEN = 1;/*Automatically cleared by hardware*/
+        ret = I2C_Wait(&SSPCON2 , I2C_SSPCON2_RSEN_MASK , 0);
+        PIR1bits.SSPIF = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief Initiate the stop condition on the SCL and SDA
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSP_I2C_Master_Send_Stop_Blocking(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SSPCON2bits.PEN = 1;/*Automatically cleared by hardware*/
+        ret = I2C_Wait(&SSPCON2 , I2C_SSPCON2_PEN_MASK , 0);
+        PIR1bits.SSPIF = 0;
+        if((E_OK == ret) && (I2C_STOP_BIT_DETECTED == SSPSTATbits.P))
+        {
+            ret = E_OK;
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    return ret;
+}
+/**
+ * @brief Write a single byte of data to a specific I2C device 
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @param i2c_data : The data wrote on the bus 
+ * @param ack : Pointer to get the state of received data from the slave
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSSP_I2C_Master_Write_blocking(const mssp_i2c_t * i2c_obj , uint8 i2c_data , uint8 * ack)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == i2c_obj) || (NULL == ack))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SSPBUF = i2c_data;
+        /*R/W instead of SSPIF, the flag may be taken by the MSSP interrupt*/
+        ret = I2C_Wait(&SSPSTAT , I2C_SSPSTAT_TRANSMIT_MASK , 0);
+        PIR1bits.SSPIF = 0;
+        if((E_OK == ret) && (I2C_ACK_RECEIVE_FROM_SLAVE == SSPCON2bits.ACKSTAT))
+        {
+            *ack = I2C_ACK_RECEIVE_FROM_SLAVE;
+        }
+        else
+        {
+            *ack = I2C_ACK_NOT_RECEIVE_FROM_SLAVE;
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Read a single byte of data to a specific I2C device 
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @param ack : The state that determines if data received 
+ *              successfully or not
+ * @param i2c_data : Pointer points to the data(uint8 type) retrieved 
+ *                   from the slave 
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if any of the retrieved pointers are NULL  
+ */
+Std_ReturnType MSSP_I2C_Master_Read_Blocking(const mssp_i2c_t * i2c_obj , uint8 ack , uint8 * i2c_data)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == i2c_obj) || (NULL == i2c_data))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        I2C_MASTER_RECEIVE_ENABLE_CFG();
+        ret = I2C_Wait(&SSPSTAT , I2C_SSPSTAT_BF_MASK , I2C_SSPSTAT_BF_MASK);
+        *i2c_data = SSPBUF;
+        if(I2C_MASTER_SEND_ACK == ack)
+        {
+            SSPCON2bits.ACKDT = 0;
+        }
+        else if(I2C_MASTER_SEND_NOT_ACK == ack)
+        {
+            SSPCON2bits.ACKDT = 1;
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        if(E_OK == ret)
+        {
+            SSPCON2bits.ACKEN = 1;/*Automatically cleared by hardware*/
+            /*The next receive can't start during the acknowledge sequence*/
+            ret = I2C_Wait(&SSPCON2 , I2C_SSPCON2_ACKEN_MASK , 0);
+        }
+        else
+        {
+            /*Nothing*/
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief Read a block from a device register/memory in one call:
+ *        start, address+W, memory address, repeated start, address+R,
+ *        length bytes(ACK, NACK on the last one), stop.
+ *        Waits for the transfer(don't call it from an ISR when the transaction engine is used)
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @param slave_address : 7-bit slave address
+ * @param mem_address : The first register/memory address to read
+ * @param mem_address_size : @ref I2C_MEM_ADDRESS_8BIT or I2C_MEM_ADDRESS_16BIT
+ * @param data : Buffer for the read bytes
+ * @param length : Number of bytes to read(at least 1)
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if a parameter is invalid, the slave doesn't acknowledge or the bus is lost  
+ */
+Std_ReturnType MSSP_I2C_Master_Mem_Read(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                        uint8 mem_address_size , uint8 * data , uint8 length)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == i2c_obj) || (NULL == data) || (0 == length) || (mem_address_size > I2C_MEM_ADDRESS_16BIT))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = I2C_Mem_Transfer(i2c_obj , slave_address , mem_address , mem_address_size , NULL , data , length);
+    }
+    return ret;
+}
+
+/**
+ * @brief Write a block to a device register/memory in one call:
+ *        start, address+W, memory address, length bytes, stop.
+ *        Waits for the transfer(don't call it from an ISR when the transaction engine is used)
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @param slave_address : 7-bit slave address
+ * @param mem_address : The first register/memory address to write
+ * @param mem_address_size : @ref I2C_MEM_ADDRESS_8BIT or I2C_MEM_ADDRESS_16BIT
+ * @param data : The bytes to write
+ * @param length : Number of bytes to write(0 only sets the device address pointer)
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if a parameter is invalid, the slave doesn't acknowledge or the bus is lost  
+ */
+Std_ReturnType MSSP_I2C_Master_Mem_Write(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                         uint8 mem_address_size , const uint8 * data , uint8 length)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == i2c_obj) || ((NULL == data) && (0 != length)) || (mem_address_size > I2C_MEM_ADDRESS_16BIT))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = I2C_Mem_Transfer(i2c_obj , slave_address , mem_address , mem_address_size , data , NULL , length);
+    }
+    return ret;
+}
+
+/**
+ * @brief Free a stuck bus: SCL/SDA are taken as GPIO, SCL is clocked(up to 9 pulses)
+ *        until the slave releases SDA, a STOP is generated and the MSSP is restarted
+ *        with its configuration. Runs automatically after a timeout, and after a bus
+ *        collision from MSSP_I2C_Master_Service when the transaction engine is used.
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type)
+ *                  that includes all the specifications of I2C mode
+ * @return E_OK if both lines are high(bus free) after the recovery
+ *         E_NOT_OK if the pointer is NULL or a line is still held low
+ */
+Std_ReturnType MSSP_I2C_Bus_Recover(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == i2c_obj)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+        /*A transaction on the bus is lost, fail it and let the queue continue*/
+        ret = I2C_Engine_Abort(0);
+#else
+        ret = I2C_Bus_Recover();
+#endif
+    }
+    return ret;
+}
+
+/**
+ * @brief Get the bus error and recovery counters
+ * @param statistics : Pointer to store the counters
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the retrieved pointer is NULL  
+ */
+Std_ReturnType MSSP_I2C_Get_Bus_Statistics(i2c_bus_statistics_t * statistics)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_bclie_status = 0;
+    if(NULL == statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*16-bit counters are updated by the ISR, block it while copying*/
+        l_bclie_status = PIE2bits.BCLIE;
+        PIE2bits.BCLIE = 0;
+        statistics->timeouts = i2c_bus_statistics.timeouts;
+        statistics->bus_collisions = i2c_bus_statistics.bus_collisions;
+        statistics->recoveries = i2c_bus_statistics.recoveries;
+        statistics->failed_recoveries = i2c_bus_statistics.failed_recoveries;
+        PIE2bits.BCLIE = l_bclie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief Reset the bus error and recovery counters
+ * @return E_OK always
+ */
+Std_ReturnType MSSP_I2C_Clear_Bus_Statistics(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_bclie_status = PIE2bits.BCLIE;
+    PIE2bits.BCLIE = 0;
+    i2c_bus_statistics.timeouts = 0;
+    i2c_bus_statistics.bus_collisions = 0;
+    i2c_bus_statistics.recoveries = 0;
+    i2c_bus_statistics.failed_recoveries = 0;
+    PIE2bits.BCLIE = l_bclie_status;
+    return ret;
+}
+
+#if I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Serve a register file as I2C slave from the MSSP interrupt(MSSP_I2C_Init in
+ *        slave mode first). Passing NULL detaches it and restores the default handler.
+ * @param register_file : Pointer to the register file description(kept while attached)
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if the registers are NULL or a region is outside the file  
+ */
+Std_ReturnType MSSP_I2C_Slave_Attach_Register_File(const i2c_slave_register_file_t * register_file)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL != register_file) &&
+       ((NULL == register_file->registers) || (0 == register_file->size) ||
+        (register_file->read_only_start > register_file->read_only_end) ||
+        (register_file->read_only_end > register_file->size) ||
+        (register_file->write_only_start > register_file->write_only_end) ||
+        (register_file->write_only_end > register_file->size)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        MSSP_I2C_InterruptDisable();
+        i2c_slave_register_file = register_file;
+        i2c_slave_pointer = 0;
+        i2c_slave_pointer_received = 0;
+        MSSP_I2C_InterruptEnable();
+    }
+    return ret;
+}
+#endif
+
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Queue a master transaction, it runs from the MSSP interrupt without busy-waiting:
+ *        start, address+W, write bytes, repeated start, address+R, read bytes(ACK, NACK
+ *        on the last one), stop. transaction->status reports the result and
+ *        Transaction_Done(if not NULL) is called from the ISR when it finishes.
+ * @param transaction : Pointer to the transaction descriptor(kept until it finishes)
+ * @return E_OK if the transaction is queued
+ *         E_NOT_OK if the pointer/buffers are NULL or the queue is full
+ */
+Std_ReturnType MSSP_I2C_Master_Submit(i2c_transaction_t * transaction)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == transaction) || ((0 != transaction->write_length) && (NULL == transaction->write_data)) ||
+       ((0 != transaction->read_length) && (NULL == transaction->read_data)) ||
+       (transaction->mem_address_size > I2C_MEM_ADDRESS_16BIT))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        MSSP_I2C_InterruptDisable();
+        if(I2C_CFG_QUEUE_SIZE == i2c_queue_count)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            transaction->status = I2C_TRANSACTION_PENDING;
+            i2c_queue[(i2c_queue_head + i2c_queue_count) % I2C_CFG_QUEUE_SIZE] = transaction;
+            i2c_queue_count++;
+            if(I2C_ENGINE_IDLE == i2c_engine_state)
+            {
+                I2C_Engine_Start_Next();
+            }
+            else
+            {
+                /*Started when the transactions ahead of it finish*/
+            }
+        }
+        MSSP_I2C_InterruptEnable();
+    }
+    return ret;
+}
+
+/**
+ * @brief Run the bus recovery requested by a bus collision, the queue is held until then.
+ *        Call it from the main loop(the waiting Mem_Read/Mem_Write call it too),
+ *        never from an ISR: the recovery clocks the bus with delays.
+ * @return E_OK if nothing was pending or the bus is free after the recovery
+ *         E_NOT_OK if a line is still held low
+ */
+Std_ReturnType MSSP_I2C_Master_Service(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_sspie_status = 0;
+    uint8 l_bclie_status = 0;
+    if(0 != i2c_recovery_pending)
+    {
+        l_sspie_status = PIE1bits.SSPIE;
+        l_bclie_status = PIE2bits.BCLIE;
+        MSSP_I2C_InterruptDisable();
+        MSSP_I2C_BUS_COL_InterruptDisable();
+        ret = I2C_Bus_Recover();
+        i2c_recovery_pending = 0;
+        if(I2C_ENGINE_RECOVER == i2c_engine_state)
+        {
+            I2C_Engine_Start_Next();
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        PIE2bits.BCLIE = l_bclie_status;
+        PIE1bits.SSPIE = l_sspie_status;
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    return ret;
+}
+#endif
+
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
+void MSSP_I2C_ISR(void)
+{
+    MSSP_I2C_InterruptFlagClear();
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+    if(I2C_ENGINE_IDLE != i2c_engine_state)
+    {
+        I2C_Engine_Step();
+    }
+    else
+#endif
+#if I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE
+    if(NULL != i2c_slave_register_file)
+    {
+        I2C_Slave_Step();
+    }
+    else
+#endif
+    if(NULL != I2C_Deafult_Interrupthandler)
+    {
+        I2C_Deafult_Interrupthandler();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+void MSSP_I2C_BUS_COL_ISR(void)
+{
+    MSSP_I2C_BUS_COL_InterruptFlagClear();
+    i2c_bus_statistics.bus_collisions++;
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+    if((I2C_ENGINE_IDLE != i2c_engine_state) && (I2C_ENGINE_RECOVER != i2c_engine_state))
+    {
+        /*The MSSP dropped the bus, the transaction is lost. The recovery is left to
+          MSSP_I2C_Master_Service, the next transaction waits for it*/
+        i2c_recovery_pending = 1;
+        I2C_Engine_Complete(I2C_TRANSACTION_BUS_ERROR);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+#endif
+    if(NULL != I2C_Report_Write_Collision_InterruptHandler)
+    {
+        I2C_Report_Write_Collision_InterruptHandler();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+#endif
+
+/*Poll until (*reg & mask) == expected, fails on a timeout or a bus collision and recovers the bus*/
+static Std_ReturnType I2C_Wait(volatile uint8 * reg , uint8 mask , uint8 expected)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_polls = I2C_WAIT_POLLS;
+    while((l_polls > 0) && ((*reg & mask) != expected) && (0 == PIR2bits.BCLIF))
+    {
+        l_polls--;
+    }
+    if(0 != PIR2bits.BCLIF)
+    {
+        PIR2bits.BCLIF = 0;
+        i2c_bus_statistics.bus_collisions++;
+        ret = E_NOT_OK;
+    }
+    else if((*reg & mask) != expected)
+    {
+        i2c_bus_statistics.timeouts++;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if(E_NOT_OK == ret)
+    {
+        I2C_Bus_Recover();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    return ret;
+}
+
+static Std_ReturnType I2C_Bus_Recover(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_pulses = 0;
+    MSSP_MODULE_DISABLE_CFG();/*SCL and SDA become port pins*/
+    LATCbits.LATC3 = 0;
+    LATCbits.LATC4 = 0;
+    I2C_SDA_RELEASE();
+    I2C_SCL_RELEASE();
+    __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+    /*A slave stopped in the middle of a byte holds SDA until it is clocked out*/
+    while((l_pulses < I2C_RECOVERY_MAX_PULSES) && (GPIO_LOW == PORTCbits.RC4))
+    {
+        I2C_SCL_DRIVE_LOW();
+        __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+        I2C_SCL_RELEASE();
+        __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+        l_pulses++;
+    }
+    /*STOP: SDA rises while SCL is high*/
+    I2C_SCL_DRIVE_LOW();
+    __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+    I2C_SDA_DRIVE_LOW();
+    __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+    I2C_SCL_RELEASE();
+    __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+    I2C_SDA_RELEASE();
+    __delay_us(I2C_RECOVERY_HALF_PERIOD_US);
+    i2c_bus_statistics.recoveries++;
+    if((GPIO_LOW == PORTCbits.RC3) || (GPIO_LOW == PORTCbits.RC4))
+    {
+        i2c_bus_statistics.failed_recoveries++;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    /*Restart the MSSP, SSPCON1/SSPADD/SSPSTAT keep the configuration*/
+    SSPCON2 &= (uint8)~I2C_SSPCON2_SEQUENCE_MASK;
+    PIR1bits.SSPIF = 0;
+    PIR2bits.BCLIF = 0;
+    MSSP_MODULE_ENABLE_CFG();
+    return ret;
+}
+
+/*Register/memory access, on the transaction engine when it is enabled*/
+static Std_ReturnType I2C_Mem_Transfer(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                       uint8 mem_address_size , const uint8 * write_data , uint8 * read_data ,
+                                       uint8 length)
+{
+    Std_ReturnType ret = E_OK;
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+    i2c_transaction_t l_transaction;
+    uint16 l_polls = 0;
+    uint8 l_events = 0;
+    (void)i2c_obj;
+    l_transaction.slave_address = slave_address;
+    l_transaction.mem_address = mem_address;
+    l_transaction.mem_address_size = mem_address_size;
+    l_transaction.write_data = write_data;
+    l_transaction.write_length = (NULL == write_data) ? 0 : length;
+    l_transaction.read_data = read_data;
+    l_transaction.read_length = (NULL == read_data) ? 0 : length;
+    l_transaction.Transaction_Done = NULL;
+    ret = MSSP_I2C_Master_Submit(&l_transaction);
+    if(E_OK == ret)
+    {
+        /*Runs from the MSSP interrupt. The timeout is per bus event of the transaction
+          on the bus, so a long transaction ahead of this one only fails when it stalls*/
+        l_events = i2c_engine_events;
+        while(I2C_TRANSACTION_PENDING == l_transaction.status)
+        {
+            MSSP_I2C_Master_Service();
+            if(l_events != i2c_engine_events)
+            {
+                l_events = i2c_engine_events;
+                l_polls = 0;
+            }
+            else
+            {
+                l_polls++;
+                if(l_polls >= I2C_WAIT_POLLS)
+                {
+                    I2C_Engine_Abort(1);
+                    l_polls = 0;
+                }
+                else
+                {
+                    /*Nothing*/
+                }
+            }
+        }
+        if(I2C_TRANSACTION_DONE != l_transaction.status)
+        {
+            ret = E_NOT_OK;
+        }
+        else
+        {
+            /*Nothing*/
+        }
+    }
+    else
+    {
+        /*Nothing*/
+    }
+#else
+    uint8 l_counter = 0;
+    ret = MSSP_I2C_Master_Send_Start_Blocking(i2c_obj);
+    if(E_OK == ret)
+    {
+        ret = I2C_Write_Acknowledged(i2c_obj , (uint8)(slave_address << 1));
+    }
+    if((E_OK == ret) && (I2C_MEM_ADDRESS_16BIT == mem_address_size))
+    {
+        ret = I2C_Write_Acknowledged(i2c_obj , (uint8)(mem_address >> 8));
+    }
+    if((E_OK == ret) && (I2C_MEM_ADDRESS_NONE != mem_address_size))
+    {
+        ret = I2C_Write_Acknowledged(i2c_obj , (uint8)mem_address);
+    }
+    for(l_counter = 0 ; (E_OK == ret) && (NULL != write_data) && (l_counter < length) ; l_counter++)
+    {
+        ret = I2C_Write_Acknowledged(i2c_obj , write_data[l_counter]);
+    }
+    if((E_OK == ret) && (NULL != read_data))
+    {
+        ret = MSSP_I2C_Master_Send_Repeated_Start_Blocking(i2c_obj);
+        if(E_OK == ret)
+        {
+            ret = I2C_Write_Acknowledged(i2c_obj , (uint8)((slave_address << 1) | 0x01));
+        }
+        for(l_counter = 0 ; (E_OK == ret) && (l_counter < length) ; l_counter++)
+        {
+            /*NACK the last byte so the slave releases SDA for the stop condition*/
+            ret = MSSP_I2C_Master_Read_Blocking(i2c_obj , ((length - 1) == l_counter) ?
+                                                I2C_MASTER_SEND_NOT_ACK : I2C_MASTER_SEND_ACK ,
+                                                &read_data[l_counter]);
+        }
+    }
+    MSSP_I2C_Master_Send_Stop_Blocking(i2c_obj);/*Release the bus on errors too*/
+#endif
+    return ret;
+}
+
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_DISABLE
+static Std_ReturnType I2C_Write_Acknowledged(const mssp_i2c_t * i2c_obj , uint8 i2c_data)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_ack = I2C_ACK_NOT_RECEIVE_FROM_SLAVE;
+    ret = MSSSP_I2C_Master_Write_blocking(i2c_obj , i2c_data , &l_ack);
+    if(I2C_ACK_RECEIVE_FROM_SLAVE != l_ack)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    return ret;
+}
+#endif
+
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+static void I2C_Engine_Start_Next(void)
+{
+    i2c_engine_events++;
+    i2c_engine_index = 0;
+    i2c_engine_result = I2C_TRANSACTION_DONE;
+    if(0 != i2c_recovery_pending)
+    {
+        i2c_engine_state = I2C_ENGINE_RECOVER;
+    }
+    else
+    {
+        i2c_engine_state = I2C_ENGINE_START;
+        SSPCON2bits.SEN = 1;
+    }
+}
+
+static void I2C_Engine_Stop(uint8 result)
+{
+    i2c_engine_result = result;
+    i2c_engine_state = I2C_ENGINE_STOP;
+    SSPCON2bits.PEN = 1;
+}
+
+static void I2C_Engine_Complete(uint8 result)
+{
+    i2c_transaction_t *l_transaction = i2c_queue[i2c_queue_head];
+    i2c_queue_head = (i2c_queue_head + 1) % I2C_CFG_QUEUE_SIZE;
+    i2c_queue_count--;
+    /*Start the next one first, so the callback can queue another transaction*/
+    if(i2c_queue_count > 0)
+    {
+        I2C_Engine_Start_Next();
+    }
+    else
+    {
+        i2c_engine_state = I2C_ENGINE_IDLE;
+    }
+    l_transaction->status = result;
+    if(NULL != l_transaction->Transaction_Done)
+    {
+        l_transaction->Transaction_Done(l_transaction);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+
+/*Recover the bus and fail the transaction on it(main context), is_timeout: count it as a timeout*/
+static Std_ReturnType I2C_Engine_Abort(uint8 is_timeout)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_sspie_status = PIE1bits.SSPIE;
+    uint8 l_bclie_status = PIE2bits.BCLIE;
+    MSSP_I2C_InterruptDisable();
+    MSSP_I2C_BUS_COL_InterruptDisable();
+    ret = I2C_Bus_Recover();
+    i2c_recovery_pending = 0;
+    if(I2C_ENGINE_RECOVER == i2c_engine_state)
+    {
+        I2C_Engine_Start_Next();/*The head hasn't started yet*/
+    }
+    else if(I2C_ENGINE_IDLE != i2c_engine_state)
+    {
+        if(0 != is_timeout)
+        {
+            i2c_bus_statistics.timeouts++;
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        I2C_Engine_Complete(I2C_TRANSACTION_BUS_ERROR);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    PIE2bits.BCLIE = l_bclie_status;
+    PIE1bits.SSPIE = l_sspie_status;
+    return ret;
+}
+
+/*One step per SSPIF: the state tells which bus event has just finished*/
+static void I2C_Engine_Step(void)
+{
+    i2c_transaction_t *l_transaction = i2c_queue[i2c_queue_head];
+    i2c_engine_events++;
+    switch(i2c_engine_state)
+    {
+        case I2C_ENGINE_START:
+            if((0 != l_transaction->mem_address_size) || (0 != l_transaction->write_length) ||
+               (0 == l_transaction->read_length))
+            {
+                SSPBUF = (uint8)(l_transaction->slave_address << 1);
+                i2c_engine_state = I2C_ENGINE_ADDRESS_WRITE;
+            }
+            else
+            {
+                SSPBUF = (uint8)((l_transaction->slave_address << 1) | 0x01);
+                i2c_engine_state = I2C_ENGINE_ADDRESS_READ;
+            }
+            break;
+        case I2C_ENGINE_ADDRESS_WRITE:
+        case I2C_ENGINE_WRITE:
+            if(I2C_ACK_NOT_RECEIVE_FROM_SLAVE == SSPCON2bits.ACKSTAT)
+            {
+                I2C_Engine_Stop(I2C_TRANSACTION_NACK);
+            }
+            else if(i2c_engine_index < l_transaction->mem_address_size)
+            {
+                if((I2C_MEM_ADDRESS_16BIT == l_transaction->mem_address_size) && (0 == i2c_engine_index))
+                {
+                    SSPBUF = (uint8)(l_transaction->mem_address >> 8);
+                }
+                else
+                {
+                    SSPBUF = (uint8)(l_transaction->mem_address);
+                }
+                i2c_engine_index++;
+                i2c_engine_state = I2C_ENGINE_WRITE;
+            }
+            else if((i2c_engine_index - l_transaction->mem_address_size) < l_transaction->write_length)
+            {
+                SSPBUF = l_transaction->write_data[i2c_engine_index - l_transaction->mem_address_size];
+                i2c_engine_index++;
+                i2c_engine_state = I2C_ENGINE_WRITE;
+            }
+            else if(0 != l_transaction->read_length)
+            {
+                i2c_engine_state = I2C_ENGINE_RESTART;
+                SSPCON2bits.RSEN = 1;
+            }
+            else
+            {
+                I2C_Engine_Stop(I2C_TRANSACTION_DONE);
+            }
+            break;
+        case I2C_ENGINE_RESTART:
+            SSPBUF = (uint8)((l_transaction->slave_address << 1) | 0x01);
+            i2c_engine_state = I2C_ENGINE_ADDRESS_READ;
+            break;
+        case I2C_ENGINE_ADDRESS_READ:
+            if(I2C_ACK_NOT_RECEIVE_FROM_SLAVE == SSPCON2bits.ACKSTAT)
+            {
+                I2C_Engine_Stop(I2C_TRANSACTION_NACK);
+            }
+            else
+            {
+                i2c_engine_index = 0;
+                i2c_engine_state = I2C_ENGINE_READ;
+                I2C_MASTER_RECEIVE_ENABLE_CFG();
+            }
+            break;
+        case I2C_ENGINE_READ:
+            l_transaction->read_data[i2c_engine_index] = SSPBUF;
+            i2c_engine_index++;
+            /*NACK the last byte so the slave releases SDA for the stop condition*/
+            if(i2c_engine_index == l_transaction->read_length)
+            {
+                SSPCON2bits.ACKDT = I2C_MASTER_SEND_NOT_ACK;
+            }
+            else
+            {
+                SSPCON2bits.ACKDT = I2C_MASTER_SEND_ACK;
+            }
+            i2c_engine_state = I2C_ENGINE_ACK;
+            SSPCON2bits.ACKEN = 1;
+            break;
+        case I2C_ENGINE_ACK:
+            if(i2c_engine_index < l_transaction->read_length)
+            {
+                i2c_engine_state = I2C_ENGINE_READ;
+                I2C_MASTER_RECEIVE_ENABLE_CFG();
+            }
+            else
+            {
+                I2C_Engine_Stop(I2C_TRANSACTION_DONE);
+            }
+            break;
+        case I2C_ENGINE_STOP:
+            I2C_Engine_Complete(i2c_engine_result);
+            break;
+        default:
+            break;
+    }
+}
+#endif
+
+#if I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE
+/*
+ * One step per SSPIF, the bus state is decoded from SSPSTAT(AN734):
+ * address+W, data written, address+R, data read and ACKed, data read and NACKed.
+ * SCL is stretched by the hardware until CKP is set again.
+ */
+static void I2C_Slave_Step(void)
+{
+    uint8 l_data = 0;
+    if(SSPCON1bits.SSPOV || SSPCON1bits.WCOL)
+    {
+        l_data = SSPBUF;
+        SSPCON1bits.SSPOV = 0;
+        SSPCON1bits.WCOL = 0;
+        if(NULL != I2C_Report_Receive_Overflow_InterruptHandler)
+        {
+            I2C_Report_Receive_Overflow_InterruptHandler();
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        SSPCON1bits.CKP = 1;
+    }
+    else if((0 == SSPSTATbits.R_nW) && (0 == SSPSTATbits.D_nA))
+    {
+        /*Address+W: the next byte is the register pointer*/
+        l_data = SSPBUF;
+        i2c_slave_pointer_received = 0;
+        SSPCON1bits.CKP = 1;
+    }
+    else if((0 == SSPSTATbits.R_nW) && (1 == SSPSTATbits.BF))
+    {
+        l_data = SSPBUF;
+        if(0 == i2c_slave_pointer_received)
+        {
+            i2c_slave_pointer = l_data;
+            i2c_slave_pointer_received = 1;
+        }
+        else
+        {
+            if((i2c_slave_pointer < i2c_slave_register_file->size) &&
+               ((i2c_slave_pointer < i2c_slave_register_file->read_only_start) ||
+                (i2c_slave_pointer >= i2c_slave_register_file->read_only_end)))
+            {
+                i2c_slave_register_file->registers[i2c_slave_pointer] = l_data;
+                if(NULL != i2c_slave_register_file->Register_Written)
+                {
+                    i2c_slave_register_file->Register_Written(i2c_slave_pointer , l_data);
+                }
+                else
+                {
+                    /*Nothing*/
+                }
+            }
+            else
+            {
+                /*Read-only or missing register, the byte is dropped*/
+            }
+            i2c_slave_pointer++;
+        }
+        SSPCON1bits.CKP = 1;
+    }
+    else if((1 == SSPSTATbits.R_nW) && (0 == SSPSTATbits.D_nA))
+    {
+        /*Address+R: SCL is held while the application refreshes the registers*/
+        l_data = SSPBUF;
+        if(NULL != i2c_slave_register_file->Read_Requested)
+        {
+            i2c_slave_register_file->Read_Requested(i2c_slave_pointer);
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        SSPBUF = I2C_Slave_Read_Register();
+        SSPCON1bits.CKP = 1;
+    }
+    else if(1 == SSPSTATbits.R_nW)
+    {
+        /*The master acknowledged the last byte and wants the next one*/
+        SSPBUF = I2C_Slave_Read_Register();
+        SSPCON1bits.CKP = 1;
+    }
+    else
+    {
+        /*The master NACKed the last byte: end of the read, the slave logic is reset*/
+    }
+}
+
+static uint8 I2C_Slave_Read_Register(void)
+{
+    uint8 l_data = I2C_SLAVE_UNREADABLE_VALUE;
+    if((i2c_slave_pointer < i2c_slave_register_file->size) &&
+       ((i2c_slave_pointer < i2c_slave_register_file->write_only_start) ||
+        (i2c_slave_pointer >= i2c_slave_register_file->write_only_end)))
+    {
+        l_data = i2c_slave_register_file->registers[i2c_slave_pointer];
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    i2c_slave_pointer++;
+    return l_data;
+}
+#endif
+
+#if I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE
+/**
+ * @brief Bus diagnostics: probes every 7-bit address at the configured clock, then for each
+ *        of 100kHz, 400kHz and 1MHz(SSPADD from _XTAL_FREQ, skipped when below 3) runs
+ *        I2C_CFG_BENCHMARK_ROUNDS rounds per device: an address probe(ACK latency = start,
+ *        address, ACK and stop) and an I2C_CFG_BENCHMARK_BYTES read(throughput), both
+ *        timed with Timer1. A round fails on a NACK, timeout or bus collision.
+ *        The report is streamed to the sink, the clock, slew rate and Timer1(count, T1CON,
+ *        TMR1IE/TMR1IF) are restored, the Timer1 interrupt is held off meanwhile.
+ *        Blocks for the whole run, reads change the current address of memory devices.
+ * @param i2c_obj : Pointer points to data(mssp_i2c_t type), initialized in master mode
+ * @param sink : Report output(e.g. EUSART_ASYNCH_FormatSink)
+ * @param context : Passed unchanged to sink
+ * @param recommended_clock : The fastest clock where every device passed every round,
+ *                            0 if no device answered or no speed was reliable
+ * @return E_OK if the function implements successfully  
+ *         E_NOT_OK if a pointer is NULL or the MSSP isn't a master  
+ */
+Std_ReturnType MSSP_I2C_Diagnose_Bus(const mssp_i2c_t * i2c_obj , std_format_sink_t sink , void * context ,
+                                     uint32 * recommended_clock)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_found[(I2C_SCAN_LAST_ADDRESS >> 3) + 1] = {0};
+    uint8 l_devices = 0;
+    uint8 l_address = 0;
+    uint8 l_speed = 0;
+    uint8 l_reliable = 0;
+    uint8 l_sspadd = 0;
+    uint8 l_smp = 0;
+    uint8 l_t1con = 0;
+    uint8 l_tmr1l = 0;
+    uint8 l_tmr1h = 0;
+    uint8 l_tmr1ie_status = 0;
+    uint8 l_tmr1if_status = 0;
+    if((NULL == i2c_obj) || (NULL == sink) || (NULL == recommended_clock) ||
+       (MSSP_I2C_MASTER_MODE != i2c_obj->i2c_config.i2c_mode))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *recommended_clock = 0;
+        l_sspadd = SSPADD;
+        l_smp = SSPSTATbits.SMP;
+        /*Timer1 is borrowed: its overflows must not reach the application handler*/
+        l_tmr1ie_status = PIE1bits.TMR1IE;
+        PIE1bits.TMR1IE = 0;
+        l_tmr1if_status = PIR1bits.TMR1IF;
+        l_t1con = T1CON;
+        l_tmr1l = TMR1L;/*Latches TMR1H in 16-bit read/write mode*/
+        l_tmr1h = TMR1H;
+        std_format(sink , context , "I2C scan at %lu Hz\r\n" , i2c_obj->i2c_clock);
+        for(l_address = I2C_SCAN_FIRST_ADDRESS ; l_address <= I2C_SCAN_LAST_ADDRESS ; l_address++)
+        {
+            if(E_OK == MSSP_I2C_Master_Mem_Write(i2c_obj , l_address , 0 , I2C_MEM_ADDRESS_NONE , NULL , 0))
+            {
+                l_found[l_address >> 3] |= (uint8)(1 << (l_address & 0x07));
+                l_devices++;
+                std_format(sink , context , "  0x%02X\r\n" , l_address);
+            }
+            else
+            {
+                /*Nothing*/
+            }
+        }
+        std_format(sink , context , "%u device(s)\r\n" , l_devices);
+        for(l_speed = 0 ; (l_devices > 0) && (l_speed < I2C_BENCHMARK_SPEEDS) ; l_speed++)
+        {
+            if(E_NOT_OK == I2C_Set_Clock(i2c_benchmark_clocks[l_speed]))
+            {
+                std_format(sink , context , "%lu Hz: SSPADD < 3 at this Fosc, skipped\r\n" ,
+                           i2c_benchmark_clocks[l_speed]);
+            }
+            else
+            {
+                /*Slew rate control is specified for 400kHz only*/
+                SSPSTATbits.SMP = (400000UL == i2c_benchmark_clocks[l_speed]) ?
+                                  I2C_SLEW_RATE_ENABLE : I2C_SLEW_RATE_DISABLE;
+                std_format(sink , context , "%lu Hz(SSPADD %u):\r\n" , i2c_benchmark_clocks[l_speed] , SSPADD);
+                l_reliable = 1;
+                for(l_address = I2C_SCAN_FIRST_ADDRESS ; l_address <= I2C_SCAN_LAST_ADDRESS ; l_address++)
+                {
+                    if((l_found[l_address >> 3] & (uint8)(1 << (l_address & 0x07))) &&
+                       (E_NOT_OK == I2C_Benchmark_Device(i2c_obj , l_address , sink , context)))
+                    {
+                        l_reliable = 0;
+                    }
+                    else
+                    {
+                        /*Nothing*/
+                    }
+                }
+                if(1 == l_reliable)
+                {
+                    *recommended_clock = i2c_benchmark_clocks[l_speed];
+                }
+                else
+                {
+                    /*Nothing*/
+                }
+            }
+        }
+        SSPADD = l_sspadd;
+        SSPSTATbits.SMP = l_smp;
+        /*Timer1 back to the application: count restored while stopped, then its T1CON*/
+        T1CON = l_t1con & (uint8)~0x01U;
+        TMR1H = l_tmr1h;
+        TMR1L = l_tmr1l;
+        T1CON = l_t1con;
+        PIR1bits.TMR1IF = l_tmr1if_status;/*Drops the overflows of the measurements*/
+        PIE1bits.TMR1IE = l_tmr1ie_status;
+        std_format(sink , context , "Recommended: %lu Hz\r\n" , *recommended_clock);
+    }
+    return ret;
+}
+
+/*Benchmark rounds on one device at the current clock, E_OK when every round passed*/
+static Std_ReturnType I2C_Benchmark_Device(const mssp_i2c_t * i2c_obj , uint8 slave_address ,
+                                           std_format_sink_t sink , void * context)
+{
+    Std_ReturnType ret = E_OK;
+    Std_ReturnType l_probe = E_OK;
+    Std_ReturnType l_read = E_OK;
+    uint8 l_data[I2C_CFG_BENCHMARK_BYTES];
+    uint8 l_round = 0;
+    uint8 l_passed = 0;
+    uint16 l_errors = 0;
+    uint16 l_latency = 0;
+    uint16 l_max_latency = 0;
+    uint16 l_read_us = 0;
+    uint32 l_total_us = 0;
+    for(l_round = 0 ; l_round < I2C_CFG_BENCHMARK_ROUNDS ; l_round++)
+    {
+        l_errors = I2C_Bus_Error_Count();
+        I2C_Timer_Start();
+        l_probe = MSSP_I2C_Master_Mem_Write(i2c_obj , slave_address , 0 , I2C_MEM_ADDRESS_NONE , NULL , 0);
+        l_latency = I2C_Timer_Elapsed_us();
+        I2C_Timer_Start();
+        l_read = MSSP_I2C_Master_Mem_Read(i2c_obj , slave_address , 0 , I2C_MEM_ADDRESS_NONE ,
+                                          l_data , I2C_CFG_BENCHMARK_BYTES);
+        l_read_us = I2C_Timer_Elapsed_us();
+        if((E_OK == l_probe) && (E_OK == l_read) && (l_errors == I2C_Bus_Error_Count()))
+        {
+            l_passed++;
+            l_total_us += l_read_us;
+            if(l_latency > l_max_latency)
+            {
+                l_max_latency = l_latency;
+            }
+            else
+            {
+                /*Nothing*/
+            }
+        }
+        else
+        {
+            ret = E_NOT_OK;
+        }
+    }
+    if(l_passed > 0)
+    {
+        l_total_us /= l_passed;
+        if(0 == l_total_us)
+        {
+            l_total_us = 1;
+        }
+        else
+        {
+            /*Nothing*/
+        }
+        std_format(sink , context , "  0x%02X: ack %u us, %lu B/s, %u/%u ok\r\n" , slave_address , l_max_latency ,
+                   ((uint32)I2C_CFG_BENCHMARK_BYTES * 1000000UL) / l_total_us , l_passed , I2C_CFG_BENCHMARK_ROUNDS);
+    }
+    else
+    {
+        std_format(sink , context , "  0x%02X: failed\r\n" , slave_address);
+    }
+    return ret;
+}
+
+static void I2C_Timer_Start(void)
+{
+    T1CON = I2C_TIMER1_CONFIG;
+    TMR1H = 0;/*Buffered, written with TMR1L*/
+    TMR1L = 0;
+    I2C_TIMER1_START();
+}
+
+static uint16 I2C_Timer_Elapsed_us(void)
+{
+    uint16 l_ticks = TMR1L;/*Latches TMR1H*/
+    l_ticks |= (uint16)TMR1H << 8;
+    /*One tick per instruction cycle(4 / Fosc), scaled in kHz so Fosc below 1MHz works too*/
+    return (uint16)(((uint32)l_ticks * 4000UL) / (_XTAL_FREQ / 1000UL));
+}
+
+/*Timeouts and collisions seen by the blocking waits or the ISR*/
+static uint16 I2C_Bus_Error_Count(void)
+{
+    uint16 l_count = 0;
+    uint8 l_bclie_status = PIE2bits.BCLIE;
+    PIE2bits.BCLIE = 0;
+    l_count = i2c_bus_statistics.timeouts + i2c_bus_statistics.bus_collisions;
+    PIE2bits.BCLIE = l_bclie_status;
+    return l_count;
+}
+#endif
+
+static inline void MSSP_I2C_Mode_GPIO_CFG(void)
+{
+    TRISCbits.TRISC3 = 1;/*Serial clock (SCL) is Input*/
+    TRISCbits.TRISC4 = 1;/*Serial data (SDA) is Input*/
+}
+static inline Std_ReturnType I2C_Master_Mode_clock_Congigrations(const mssp_i2c_t * i2c_obj)
+{
+    Std_ReturnType ret = E_OK;
+    SSPCON1bits.SSPM = I2C_MASTER_MODE_DEFINED_CLOCK;
+    ret = I2C_Set_Clock(i2c_obj->i2c_clock);
+    return ret;
+}
+static Std_ReturnType I2C_Set_Clock(uint32 clock)
+{
+    Std_ReturnType ret = E_OK;
+    /*A clock above Fosc/4 wraps the unsigned result above I2C_SSPADD_MAX*/
+    if((0 == clock) || (I2C_SSPADD_FROM_CLOCK(clock) < I2C_SSPADD_MIN) ||
+       (I2C_SSPADD_FROM_CLOCK(clock) > I2C_SSPADD_MAX))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        SSPADD = (uint8)I2C_SSPADD_FROM_CLOCK(clock);
+    }
+    return ret;
+}
+static inline void I2C_Slew_Control(const mssp_i2c_t * i2c_obj)
+{
+    if(I2C_SLEW_RATE_ENABLE == i2c_obj->i2c_config.i2c_slew_rate)
+    {
+        I2C_SLEW_RATE_ENABLE_CFG();
+    }
+    else if(I2C_SLEW_RATE_DISABLE == i2c_obj->i2c_config.i2c_slew_rate)
+    {
+        I2C_SLEW_RATE_DISABLE_CFG();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+static inline void I2C_SMBus_Enable_Or_Disable(const mssp_i2c_t * i2c_obj)
+{
+    if(I2C_SMBUS_ENABLE == i2c_obj->i2c_config.i2c_SMBus_control)
+    {
+        I2C_SMBUS_ENABLE_CFG();
+    }
+    else if(I2C_SMBUS_DISABLE == i2c_obj->i2c_config.i2c_SMBus_control)
+    {
+        I2C_SMBUS_DISABLE_CFG();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+static inline void MSSP_I2C_Interrupt_Configrations(const mssp_i2c_t * i2c_obj)
+{
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
+        MSSP_I2C_InterruptEnable();
+        MSSP_I2C_BUS_COL_InterruptEnable();
+        MSSP_I2C_InterruptFlagClear();
+        MSSP_I2C_BUS_COL_InterruptFlagClear();
+        I2C_Report_Write_Collision_InterruptHandler = i2c_obj->I2C_Report_Write_Collision;
+        I2C_Deafult_Interrupthandler = i2c_obj->I2C_Deafult_Interrupthandler;
+        I2C_Report_Receive_Overflow_InterruptHandler = i2c_obj->I2C_Report_Receive_Overflow;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+        INTERRUPT_PriorityLevelEnable();
+        if(INTERRUPT_HIGH_PRIORITY == i2c_obj->i2c_config.mssp_i2c_priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            MSSP_I2C_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == i2c_obj->i2c_config.mssp_i2c_priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            MSSP_I2C_LowPrioritySet();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        if(INTERRUPT_HIGH_PRIORITY == i2c_obj->i2c_config.mssp_i2c_bus_col_priority)
+        {
+            INTERRUPT_GlobalInterruptHighEnable();
+            MSSP_I2C_BUS_COL_HighPrioritySet();
+        }
+        else if(INTERRUPT_LOW_PRIORITY == i2c_obj->i2c_config.mssp_i2c_bus_col_priority)
+        {
+            INTERRUPT_GlobalInterruptLowEnable();
+            MSSP_I2C_BUS_COL_LowPrioritySet();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#else
+        INTERRUPT_GlobalInterruptEnable();
+        INTERRUPT_PeripheralInterruptEnable();
+#endif        
+#endif   
+}
+
@@ -1,108 +1,210 @@
-/* 
- * File:   hal_i2c.h
- * Author: Yousab Gamal(yous.gmm@gmail.com)
- *
- * Created on December 8, 2025, 1:39 PM
- */
-
-#ifndef HAL_I2C_H
-#define	HAL_I2C_H
-
-/******************Section: Includes**********************/
-#include "../GPIO/hal_gpio.h"
-#include "../interrupt/mcal_internal_interrupt.h"
-#include "../../MCAL_Layer/mcal_std_types.h"
-#include "pic18f4620.h"
-
-/******************Section: Macros Declarations***********/
-                    /*Slew Rate Enable/Disable*/
-#define I2C_SLEW_RATE_ENABLE    0
-#define I2C_SLEW_RATE_DISABLE   1
-                    /*SMBus Enable/Disable*/
-#define I2C_SMBUS_ENABLE    1
-#define I2C_SMBUS_DISABLE   0
-                    /*Slave Mode Data/Address Indication*/
-#define I2C_LAST_BYTE_DATA    1
-#define I2C_LAST_BYTE_ADDRESS 0
-                    /*Stop Condition Indication*/
-#define I2C_STOP_BIT_DETECTED     1
-#define I2C_STOP_BIT_NOT_DETECTED 0
-                    /*Start Condition Indication*/
-#define I2C_START_BIT_DETECTED     1 
-#define I2C_START_BIT_NOT_DETECTED 0
-                    /*I2C Master/Slave Mode*/
-#define MSSP_I2C_MASTER_MODE 1
-#define MSSP_I2C_SLAVE_MODE  0 
-                    /*Master Synch Serial Port Mode Select*/
-#define I2C_SLAVE_MODE_7BIT_ADDRESS                 0X06U
-#define I2C_SLAVE_MODE_10BIT_ADDRESS                0X07U
-#define I2C_SLAVE_MODE_7BIT_ADDRESS_SS_INT_ENABLE   0X0EU
-#define I2C_SLAVE_MODE_10BIT_ADDRESS_SS_INT_ENABLE  0X0FU
-#define I2C_MASTER_MODE_DEFINED_CLOCK               0X08U
-#define I2C_MASTER_MODE_FIRMWARE_CONTROLLED         0X0BU
-                    /*General Call Enable/Disable*/
-#define I2C_GENERAL_CALL_ENABLE  1
-#define I2C_GENERAL_CALL_DISABLE 0
-                    /*Master Mode Receive Enable/Disable*/
-#define I2C_MASTER_RECEIVE_ENABLE  1
-#define I2C_MASTER_RECEIVE_DISABLE 0
-                    /*Acknowledge Status bit (Master Transmit mode only)*/
-#define I2C_ACK_RECEIVE_FROM_SLAVE     0
-#define I2C_ACK_NOT_RECEIVE_FROM_SLAVE 1
-                    /*Acknowledge Status bit (Master Receive mode only)*/
-#define I2C_MASTER_SEND_ACK      0
-#define I2C_MASTER_SEND_NOT_ACK  1
-
-/******************Section: Macros Functions Declarations*/
-                    /*Slew Rate Enable/Disable*/
-#define I2C_SLEW_RATE_ENABLE_CFG()  (SSPSTATbits.SMP = I2C_SLEW_RATE_ENABLE)
-#define I2C_SLEW_RATE_DISABLE_CFG() (SSPSTATbits.SMP = I2C_SLEW_RATE_DISABLE)
-                    /*SMBus Enable/Disable*/
-#define I2C_SMBUS_ENABLE_CFG()      (SSPSTATbits.CKE = I2C_SMBUS_ENABLE)
-#define I2C_SMBUS_DISABLE_CFG()     (SSPSTATbits.CKE = I2C_SMBUS_DISABLE)
-                    /*General Call Enable/Disable*/
-#define I2C_GENERAL_CALL_ENABLE_CFG()   (SSPCON2bits.GCEN = I2C_GENERAL_CALL_ENABLE)
-#define I2C_GENERAL_CALL_DISABLE_CFG()  (SSPCON2bits.GCEN = I2C_GENERAL_CALL_DISABLE)
-                    /*Master Mode Receive Enable/Disable*/
-#define I2C_MASTER_RECEIVE_ENABLE_CFG() (SSPCON2bits.RCEN = I2C_MASTER_RECEIVE_ENABLE)
-#define I2C_MASTER_RECEIVE_DISABLE_CFG()(SSPCON2bits.RCEN = I2C_MASTER_RECEIVE_DISABLE)
-                    /*Master Synch Serial Port Enable/Disable*/
-#define MSSP_MODULE_ENABLE_CFG()     (SSPCON1bits.SSPEN = 1)
-#define MSSP_MODULE_DISABLE_CFG()    (SSPCON1bits.SSPEN = 0)
-
-/******************Section: Data Types Declarations*******/
-typedef struct{
-    uint8 i2c_mode_cfg;           /*Master synch serial port mode select*/
-    uint8 i2c_mode : 1;           /*Master mode or slave mode*/
-    uint8 i2c_slew_rate : 1;      /*Slew rate enable or disable(I2C speed)*/
-    uint8 i2c_SMBus_control : 1;  /*SMBus enable or disable*/
-    uint8 i2c_general_call : 1;   /*General call enable or disable*/
-    uint8 i2c_master_rec_mode : 1;/*Master receive enable or disable*/
-    uint8 i2c_reserved : 3;
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE    
-    interrupt_priority_cfg mssp_i2c_priority;  
-    interrupt_priority_cfg mssp_i2c_bus_col_priority;  
-#endif 
-}i2c_configs_t;
-
-typedef struct{
-    uint32 i2c_clock; /*Master clock frequency*/
-#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE    
-    void (*I2C_Report_Write_Collision)(void);
-    void (*I2C_Deafult_Interrupthandler)(void);  
-    void (*I2C_Report_Receive_Overflow)(void);
-#endif    
-    i2c_configs_t i2c_config;
-}mssp_i2c_t;
-
-/******************Section: Functions Declarations********/
-Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj);
-Std_ReturnType MSSP_I2C_Deinit(const mssp_i2c_t * i2c_obj);
-Std_ReturnType MSSP_I2C_Master_Send_Start_Blocking(const mssp_i2c_t * i2c_obj);
-Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start_Blocking(const mssp_i2c_t * i2c_obj);
-Std_ReturnType MSSP_I2C_Master_Send_Stop_Blocking(const mssp_i2c_t * i2c_obj);
-Std_ReturnType MSSSP_I2C_Master_Write_blocking(const mssp_i2c_t * i2c_obj , uint8 i2c_data , uint8 * ack);
-Std_ReturnType MSSP_I2C_Master_Read_Blocking(const mssp_i2c_t * i2c_obj , uint8 ack , uint8 * i2c_data);
-
-#endif	/* HAL_I2C_H */
-
+/* 
+ * File:   hal_i2c.h
+ * Author: Yousab Gamal(yous.gmm@gmail.com)
+ *
+ * Created on December 8, 2025, 1:39 PM
+ */
+
+#ifndef HAL_I2C_H
+#define	HAL_I2C_H
+
+/******************Section: Includes**********************/
+#include "hal_i2c_cfg.h"
+#include "../GPIO/hal_gpio.h"
+#include "../interrupt/mcal_internal_interrupt.h"
+#include "../../MCAL_Layer/mcal_std_types.h"
+#if I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE
+#include "../std_format.h"
+#endif
+#include "pic18f4620.h"
+
+/******************Section: Macros Declarations***********/
+                    /*Slew Rate Enable/Disable*/
+#define I2C_SLEW_RATE_ENABLE    0
+#define I2C_SLEW_RATE_DISABLE   1
+                    /*SMBus Enable/Disable*/
+#define I2C_SMBUS_ENABLE    1
+#define I2C_SMBUS_DISABLE   0
+                    /*Slave Mode Data/Address Indication*/
+#define I2C_LAST_BYTE_DATA    1
+#define I2C_LAST_BYTE_ADDRESS 0
+                    /*Stop Condition Indication*/
+#define I2C_STOP_BIT_DETECTED     1
+#define I2C_STOP_BIT_NOT_DETECTED 0
+                    /*Start Condition Indication*/
+#define I2C_START_BIT_DETECTED     1 
+#define I2C_START_BIT_NOT_DETECTED 0
+                    /*I2C Master/Slave Mode*/
+#define MSSP_I2C_MASTER_MODE 1
+#define MSSP_I2C_SLAVE_MODE  0 
+                    /*Master Synch Serial Port Mode Select*/
+#define I2C_SLAVE_MODE_7BIT_ADDRESS                 0X06U
+#define I2C_SLAVE_MODE_10BIT_ADDRESS                0X07U
+#define I2C_SLAVE_MODE_7BIT_ADDRESS_SS_INT_ENABLE   0X0EU
+#define I2C_SLAVE_MODE_10BIT_ADDRESS_SS_INT_ENABLE  0X0FU
+#define I2C_MASTER_MODE_DEFINED_CLOCK               0X08U
+#define I2C_MASTER_MODE_FIRMWARE_CONTROLLED         0X0BU
+                    /*General Call Enable/Disable*/
+#define I2C_GENERAL_CALL_ENABLE  1
+#define I2C_GENERAL_CALL_DISABLE 0
+                    /*Master Mode Receive Enable/Disable*/
+#define I2C_MASTER_RECEIVE_ENABLE  1
+#define I2C_MASTER_RECEIVE_DISABLE 0
+                    /*Acknowledge Status bit (Master Transmit mode only)*/
+#define I2C_ACK_RECEIVE_FROM_SLAVE     0
+#define I2C_ACK_NOT_RECEIVE_FROM_SLAVE 1
+                    /*Acknowledge Status bit (Master Receive mode only)*/
+#define I2C_MASTER_SEND_ACK      0
+#define I2C_MASTER_SEND_NOT_ACK  1
+                    /*Transaction status*/
+#define I2C_TRANSACTION_IDLE       0x00U
+#define I2C_TRANSACTION_PENDING    0x01U   /*Queued or on the bus*/
+#define I2C_TRANSACTION_DONE       0x02U
+#define I2C_TRANSACTION_NACK       0x03U   /*Address or data byte not acknowledged*/
+#define I2C_TRANSACTION_BUS_ERROR  0x04U   /*Bus collision*/
+                    /*Memory/register address size in bytes(sent MSB first)*/
+#define I2C_MEM_ADDRESS_NONE       0x00U
+#define I2C_MEM_ADDRESS_8BIT       0x01U
+#define I2C_MEM_ADDRESS_16BIT      0x02U
+
+#if (I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE) && \
+    (MSSP_I2C_INTERRUPT_ENABLE_FEATURE != INTERRUPT_FEATURE_ENABLE)
+#error "I2C_CFG_TRANSACTION_ENGINE needs MSSP_I2C_INTERRUPT_ENABLE_FEATURE"
+#endif
+#if (I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE) && \
+    (MSSP_I2C_INTERRUPT_ENABLE_FEATURE != INTERRUPT_FEATURE_ENABLE)
+#error "I2C_CFG_SLAVE_REGISTER_FILE needs MSSP_I2C_INTERRUPT_ENABLE_FEATURE"
+#endif
+                    /*Value the slave returns for write-only or missing registers*/
+#define I2C_SLAVE_UNREADABLE_VALUE 0xFFU
+
+                    /*Bus recovery: SCL clock pulses to free SDA(one byte + ACK)*/
+#define I2C_RECOVERY_MAX_PULSES    9U
+#define I2C_RECOVERY_HALF_PERIOD_US 5U
+
+                    /*Master baud rate generator: SSPADD<6:0>, below 3 isn't supported*/
+#define I2C_SSPADD_MIN             3UL
+#define I2C_SSPADD_MAX             0x7FUL
+                    /*Diagnostics: 7-bit addresses outside the reserved groups*/
+#define I2C_SCAN_FIRST_ADDRESS     0x08U
+#define I2C_SCAN_LAST_ADDRESS      0x77U
+#if (I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE) && (I2C_CFG_BENCHMARK_BYTES > 255U)
+#error "I2C_CFG_BENCHMARK_BYTES must fit one Mem_Read"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+                    /*Slew Rate Enable/Disable*/
+#define I2C_SLEW_RATE_ENABLE_CFG()  (SSPSTATbits.SMP = I2C_SLEW_RATE_ENABLE)
+#define I2C_SLEW_RATE_DISABLE_CFG() (SSPSTATbits.SMP = I2C_SLEW_RATE_DISABLE)
+                    /*SMBus Enable/Disable*/
+#define I2C_SMBUS_ENABLE_CFG()      (SSPSTATbits.CKE = I2C_SMBUS_ENABLE)
+#define I2C_SMBUS_DISABLE_CFG()     (SSPSTATbits.CKE = I2C_SMBUS_DISABLE)
+                    /*General Call Enable/Disable*/
+#define I2C_GENERAL_CALL_ENABLE_CFG()   (SSPCON2bits.GCEN = I2C_GENERAL_CALL_ENABLE)
+#define I2C_GENERAL_CALL_DISABLE_CFG()  (SSPCON2bits.GCEN = I2C_GENERAL_CALL_DISABLE)
+                    /*Master Mode Receive Enable/Disable*/
+#define I2C_MASTER_RECEIVE_ENABLE_CFG() (SSPCON2bits.RCEN = I2C_MASTER_RECEIVE_ENABLE)
+#define I2C_MASTER_RECEIVE_DISABLE_CFG()(SSPCON2bits.RCEN = I2C_MASTER_RECEIVE_DISABLE)
+                    /*Master Synch Serial Port Enable/Disable*/
+#define MSSP_MODULE_ENABLE_CFG()     (SSPCON1bits.SSPEN = 1)
+#define MSSP_MODULE_DISABLE_CFG()    (SSPCON1bits.SSPEN = 0)
+                    /*SSPADD for a master clock(integer, no float code)*/
+#define I2C_SSPADD_FROM_CLOCK(CLOCK) (((_XTAL_FREQ / 4UL) / (CLOCK)) - 1UL)
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+    uint8 i2c_mode_cfg;           /*Master synch serial port mode select*/
+    uint8 i2c_slave_address;      /*Own 7-bit address(slave mode)*/
+    uint8 i2c_mode : 1;           /*Master mode or slave mode*/
+    uint8 i2c_slew_rate : 1;      /*Slew rate enable or disable(I2C speed)*/
+    uint8 i2c_SMBus_control : 1;  /*SMBus enable or disable*/
+    uint8 i2c_general_call : 1;   /*General call enable or disable*/
+    uint8 i2c_master_rec_mode : 1;/*Master receive enable or disable*/
+    uint8 i2c_reserved : 3;
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE    
+    interrupt_priority_cfg mssp_i2c_priority;  
+    interrupt_priority_cfg mssp_i2c_bus_col_priority;  
+#endif 
+}i2c_configs_t;
+
+typedef struct{
+    uint32 i2c_clock; /*Master clock frequency*/
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE    
+    void (*I2C_Report_Write_Collision)(void);
+    void (*I2C_Deafult_Interrupthandler)(void);  
+    void (*I2C_Report_Receive_Overflow)(void);
+#endif    
+    i2c_configs_t i2c_config;
+}mssp_i2c_t;
+
+/*
+ * Master transaction: the mem_address bytes and write_length bytes are sent, then
+ * read_length bytes are read after a repeated start(any part may be 0, all 0 probes
+ * the address).
+ * The descriptor and its buffers must stay valid until status leaves I2C_TRANSACTION_PENDING.
+ */
+typedef struct i2c_transaction{
+    uint8 slave_address;        /*7-bit address*/
+    uint16 mem_address;         /*Register/memory pointer written first*/
+    uint8 mem_address_size;     /*@ref I2C_MEM_ADDRESS_NONE ...*/
+    const uint8 *write_data;
+    uint8 write_length;
+    uint8 *read_data;
+    uint8 read_length;
+    void (*Transaction_Done)(struct i2c_transaction *transaction);  /*Called from the ISR, may be NULL*/
+    volatile uint8 status;
+}i2c_transaction_t;
+
+typedef struct{
+    uint16 timeouts;              /*Bus events that didn't finish in I2C_CFG_TIMEOUT_US*/
+    uint16 bus_collisions;        /*BCLIF events*/
+    uint16 recoveries;            /*Recovery sequences run*/
+    uint16 failed_recoveries;     /*SCL or SDA still held low after the recovery*/
+}i2c_bus_statistics_t;
+
+/*
+ * Slave register file: the first byte of a write sets the register pointer, the next
+ * bytes are stored from it, a read returns bytes from it, the pointer auto-increments.
+ * Regions are [start , end), start == end means no region.
+ */
+typedef struct{
+    uint8 *registers;
+    uint8 size;
+    uint8 read_only_start;        /*Writes from the master are ignored*/
+    uint8 read_only_end;
+    uint8 write_only_start;       /*Read back as I2C_SLAVE_UNREADABLE_VALUE*/
+    uint8 write_only_end;
+    void (*Register_Written)(uint8 address , uint8 value);  /*ISR context, may be NULL*/
+    void (*Read_Requested)(uint8 address);  /*ISR context with SCL stretched, update the
+                                              registers before they are sent, may be NULL*/
+}i2c_slave_register_file_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType MSSP_I2C_Init(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSP_I2C_Deinit(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSP_I2C_Master_Send_Start_Blocking(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSP_I2C_Master_Send_Repeated_Start_Blocking(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSP_I2C_Master_Send_Stop_Blocking(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSSP_I2C_Master_Write_blocking(const mssp_i2c_t * i2c_obj , uint8 i2c_data , uint8 * ack);
+Std_ReturnType MSSP_I2C_Master_Read_Blocking(const mssp_i2c_t * i2c_obj , uint8 ack , uint8 * i2c_data);
+Std_ReturnType MSSP_I2C_Master_Mem_Read(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                        uint8 mem_address_size , uint8 * data , uint8 length);
+Std_ReturnType MSSP_I2C_Master_Mem_Write(const mssp_i2c_t * i2c_obj , uint8 slave_address , uint16 mem_address ,
+                                         uint8 mem_address_size , const uint8 * data , uint8 length);
+Std_ReturnType MSSP_I2C_Bus_Recover(const mssp_i2c_t * i2c_obj);
+Std_ReturnType MSSP_I2C_Get_Bus_Statistics(i2c_bus_statistics_t * statistics);
+Std_ReturnType MSSP_I2C_Clear_Bus_Statistics(void);
+#if I2C_CFG_SLAVE_REGISTER_FILE == I2C_CFG_FEATURE_ENABLE
+Std_ReturnType MSSP_I2C_Slave_Attach_Register_File(const i2c_slave_register_file_t * register_file);
+#endif
+#if I2C_CFG_TRANSACTION_ENGINE == I2C_CFG_FEATURE_ENABLE
+Std_ReturnType MSSP_I2C_Master_Submit(i2c_transaction_t * transaction);
+Std_ReturnType MSSP_I2C_Master_Service(void);
+#endif
+#if I2C_CFG_DIAGNOSTICS == I2C_CFG_FEATURE_ENABLE
+Std_ReturnType MSSP_I2C_Diagnose_Bus(const mssp_i2c_t * i2c_obj , std_format_sink_t sink , void * context ,
+                                     uint32 * recommended_clock);
+#endif
+
+#endif	/* HAL_I2C_H */
+
@@ -0,0 +1,39 @@
+/* 
+ * File:   hal_i2c_cfg.h
+ */
+
+#ifndef HAL_I2C_CFG_H
+#define	HAL_I2C_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define I2C_CFG_FEATURE_ENABLE          1
+#define I2C_CFG_FEATURE_DISABLE         0
+
+/*Interrupt driven master transactions(needs MSSP_I2C_INTERRUPT_ENABLE_FEATURE)*/
+#define I2C_CFG_TRANSACTION_ENGINE      I2C_CFG_FEATURE_ENABLE
+/*Transactions that can wait for the bus at the same time*/
+#define I2C_CFG_QUEUE_SIZE              4U
+
+/*Longest wait for one bus event(start, byte, stop...) before the bus is declared stuck,
+  then the bus is recovered(SCL clock-out, STOP, MSSP restart)*/
+#define I2C_CFG_TIMEOUT_US              1000UL
+
+/*Slave mode served from the MSSP interrupt as a register file(needs MSSP_I2C_INTERRUPT_ENABLE_FEATURE)*/
+#define I2C_CFG_SLAVE_REGISTER_FILE     I2C_CFG_FEATURE_ENABLE
+
+/*Bus scanner and 100k/400k/1M benchmark(MSSP_I2C_Diagnose_Bus), borrows Timer1 while it runs*/
+#define I2C_CFG_DIAGNOSTICS             I2C_CFG_FEATURE_ENABLE
+/*Bytes read from every device per benchmark round*/
+#define I2C_CFG_BENCHMARK_BYTES         16U
+/*Rounds per device and speed, a speed is reliable when all of them pass*/
+#define I2C_CFG_BENCHMARK_ROUNDS        4U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* HAL_I2C_CFG_H */
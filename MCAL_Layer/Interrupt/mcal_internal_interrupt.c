@@ -1,8 +1,8 @@
-/* 
- * File:   mcal_internal_interrupt.c
- * Author: yousg
- *
- * Created on March 10, 2025, 4:57 PM
- */
-#include "mcal_internal_interrupt.h"
-
+/* 
+ * File:   mcal_internal_interrupt.c
+ * Author: yousg
+ *
+ * Created on March 10, 2025, 4:57 PM
+ */
+#include "mcal_internal_interrupt.h"
+
@@ -1,37 +1,178 @@
-/* 
- * File:   mcal_internal_interrupt.h
- * Author: yousg
- *
- * Created on March 10, 2025, 4:56 PM
- */
-
-#ifndef MCAL_INTERNAL_INTERRUPT_H
-#define	MCAL_INTERNAL_INTERRUPT_H
-
-
-/******************Section: Includes**********************/
-#include "mcal_interrupt_cfg.h"
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-#if ADC_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    /*Clear the interrupt enable for the ADC module*/
-    #define ADC_InterruptDisable()      (PIE1bits.ADIE = 0)
-    /*Sets the interrupt enable for the ADC module*/
-    #define ADC_InterruptEnable()       (PIE1bits.ADIE = 1)
-    /*Clear interrupt flag for the ADC module*/
-    #define ADC_InterruptFlagClear()    (PIR1bits.ADIF = 0)
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-    /*Set ADC interrupt priority to high*/
-    #define ADC_HighPrioritySet()       (IPR1bits.ADIP = 1)
-    /*Set ADC interrupt priority to low*/
-    #define ADC_LowPrioritySet()        (IPR1bits.ADIP  = 0)
-#endif
-#endif
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* MCAL_INTERNAL_INTERRUPT_H */
-
+/* 
+ * File:   mcal_internal_interrupt.h
+ * Author: yousg
+ *
+ * Created on March 10, 2025, 4:56 PM
+ */
+
+#ifndef MCAL_INTERNAL_INTERRUPT_H
+#define	MCAL_INTERNAL_INTERRUPT_H
+
+
+/******************Section: Includes**********************/
+#include "mcal_interrupt_cfg.h"
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+#if ADC_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the ADC module*/
+    #define ADC_InterruptDisable()      (PIE1bits.ADIE = 0)
+    /*Sets the interrupt enable for the ADC module*/
+    #define ADC_InterruptEnable()       (PIE1bits.ADIE = 1)
+    /*Clear interrupt flag for the ADC module*/
+    #define ADC_InterruptFlagClear()    (PIR1bits.ADIF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set ADC interrupt priority to high*/
+    #define ADC_HighPrioritySet()       (IPR1bits.ADIP = 1)
+    /*Set ADC interrupt priority to low*/
+    #define ADC_LowPrioritySet()        (IPR1bits.ADIP  = 0)
+#endif
+#endif
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the EUSART transmitter*/
+    #define EUSART_TX_InterruptDisable()      (PIE1bits.TXIE = 0)
+    /*Sets the interrupt enable for the EUSART transmitter*/
+    #define EUSART_TX_InterruptEnable()       (PIE1bits.TXIE = 1)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set EUSART transmitter interrupt priority to high*/
+    #define EUSART_TX_HighPrioritySet()       (IPR1bits.TXIP = 1)
+    /*Set EUSART transmitter interrupt priority to low*/
+    #define EUSART_TX_LowPrioritySet()        (IPR1bits.TXIP = 0)
+#endif
+#endif
+
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the EUSART receiver*/
+    #define EUSART_RX_InterruptDisable()      (PIE1bits.RCIE = 0)
+    /*Sets the interrupt enable for the EUSART receiver*/
+    #define EUSART_RX_InterruptEnable()       (PIE1bits.RCIE = 1)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set EUSART receiver interrupt priority to high*/
+    #define EUSART_RX_HighPrioritySet()       (IPR1bits.RCIP = 1)
+    /*Set EUSART receiver interrupt priority to low*/
+    #define EUSART_RX_LowPrioritySet()        (IPR1bits.RCIP = 0)
+#endif
+#endif
+
+#if TIMER0_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the TIMER0 module*/
+    #define TIMER0_InterruptDisable()         (INTCONbits.TMR0IE = 0)
+    /*Sets the interrupt enable for the TIMER0 module*/
+    #define TIMER0_InterruptEnable()          (INTCONbits.TMR0IE = 1)
+    /*Clear interrupt flag for the TIMER0 module*/
+    #define TIMER0_InterruptFlagClear()       (INTCONbits.TMR0IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set TIMER0 interrupt priority to high*/
+    #define TIMER0_HighPrioritySet()          (INTCON2bits.TMR0IP = 1)
+    /*Set TIMER0 interrupt priority to low*/
+    #define TIMER0_LowPrioritySet()           (INTCON2bits.TMR0IP = 0)
+#endif
+#endif
+
+#if TIMER1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the TIMER1 module*/
+    #define TIMER1_InterruptDisable()         (PIE1bits.TMR1IE = 0)
+    /*Sets the interrupt enable for the TIMER1 module*/
+    #define TIMER1_InterruptEnable()          (PIE1bits.TMR1IE = 1)
+    /*Clear interrupt flag for the TIMER1 module*/
+    #define TIMER1_InterruptFlagClear()       (PIR1bits.TMR1IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set TIMER1 interrupt priority to high*/
+    #define TIMER1_HighPrioritySet()          (IPR1bits.TMR1IP = 1)
+    /*Set TIMER1 interrupt priority to low*/
+    #define TIMER1_LowPrioritySet()           (IPR1bits.TMR1IP = 0)
+#endif
+#endif
+
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the TIMER2 module*/
+    #define TIMER2_InterruptDisable()         (PIE1bits.TMR2IE = 0)
+    /*Sets the interrupt enable for the TIMER2 module*/
+    #define TIMER2_InterruptEnable()          (PIE1bits.TMR2IE = 1)
+    /*Clear interrupt flag for the TIMER2 module*/
+    #define TIMER2_InterruptFlagClear()       (PIR1bits.TMR2IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set TIMER2 interrupt priority to high*/
+    #define TIMER2_HighPrioritySet()          (IPR1bits.TMR2IP = 1)
+    /*Set TIMER2 interrupt priority to low*/
+    #define TIMER2_LowPrioritySet()           (IPR1bits.TMR2IP = 0)
+#endif
+#endif
+
+#if TIMER3_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the TIMER3 module*/
+    #define TIMER3_InterruptDisable()         (PIE2bits.TMR3IE = 0)
+    /*Sets the interrupt enable for the TIMER3 module*/
+    #define TIMER3_InterruptEnable()          (PIE2bits.TMR3IE = 1)
+    /*Clear interrupt flag for the TIMER3 module*/
+    #define TIMER3_InterruptFlagClear()       (PIR2bits.TMR3IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set TIMER3 interrupt priority to high*/
+    #define TIMER3_HighPrioritySet()          (IPR2bits.TMR3IP = 1)
+    /*Set TIMER3 interrupt priority to low*/
+    #define TIMER3_LowPrioritySet()           (IPR2bits.TMR3IP = 0)
+#endif
+#endif
+
+#if CCP1_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the CCP1 module*/
+    #define CCP1_InterruptDisable()           (PIE1bits.CCP1IE = 0)
+    /*Sets the interrupt enable for the CCP1 module*/
+    #define CCP1_InterruptEnable()            (PIE1bits.CCP1IE = 1)
+    /*Clear interrupt flag for the CCP1 module*/
+    #define CCP1_InterruptFlagClear()         (PIR1bits.CCP1IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set CCP1 interrupt priority to high*/
+    #define CCP1_HighPrioritySet()            (IPR1bits.CCP1IP = 1)
+    /*Set CCP1 interrupt priority to low*/
+    #define CCP1_LowPrioritySet()             (IPR1bits.CCP1IP = 0)
+#endif
+#endif
+
+#if CCP2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the CCP2 module*/
+    #define CCP2_InterruptDisable()           (PIE2bits.CCP2IE = 0)
+    /*Sets the interrupt enable for the CCP2 module*/
+    #define CCP2_InterruptEnable()            (PIE2bits.CCP2IE = 1)
+    /*Clear interrupt flag for the CCP2 module*/
+    #define CCP2_InterruptFlagClear()         (PIR2bits.CCP2IF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set CCP2 interrupt priority to high*/
+    #define CCP2_HighPrioritySet()            (IPR2bits.CCP2IP = 1)
+    /*Set CCP2 interrupt priority to low*/
+    #define CCP2_LowPrioritySet()             (IPR2bits.CCP2IP = 0)
+#endif
+#endif
+
+#if MSSP_I2C_INTERRUPT_ENABLE_FEATURE == INTERRUPT_FEATURE_ENABLE
+    /*Clear the interrupt enable for the MSSP module(I2C)*/
+    #define MSSP_I2C_InterruptDisable()           (PIE1bits.SSPIE = 0)
+    /*Sets the interrupt enable for the MSSP module(I2C)*/
+    #define MSSP_I2C_InterruptEnable()            (PIE1bits.SSPIE = 1)
+    /*Clear interrupt flag for the MSSP module(I2C)*/
+    #define MSSP_I2C_InterruptFlagClear()         (PIR1bits.SSPIF = 0)
+    /*Clear the interrupt enable for the MSSP bus collision*/
+    #define MSSP_I2C_BUS_COL_InterruptDisable()   (PIE2bits.BCLIE = 0)
+    /*Sets the interrupt enable for the MSSP bus collision*/
+    #define MSSP_I2C_BUS_COL_InterruptEnable()    (PIE2bits.BCLIE = 1)
+    /*Clear interrupt flag for the MSSP bus collision*/
+    #define MSSP_I2C_BUS_COL_InterruptFlagClear() (PIR2bits.BCLIF = 0)
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+    /*Set MSSP interrupt priority to high*/
+    #define MSSP_I2C_HighPrioritySet()            (IPR1bits.SSPIP = 1)
+    /*Set MSSP interrupt priority to low*/
+    #define MSSP_I2C_LowPrioritySet()             (IPR1bits.SSPIP = 0)
+    /*Set MSSP bus collision interrupt priority to high*/
+    #define MSSP_I2C_BUS_COL_HighPrioritySet()    (IPR2bits.BCLIP = 1)
+    /*Set MSSP bus collision interrupt priority to low*/
+    #define MSSP_I2C_BUS_COL_LowPrioritySet()     (IPR2bits.BCLIP = 0)
+#endif
+#endif
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* MCAL_INTERNAL_INTERRUPT_H */
+
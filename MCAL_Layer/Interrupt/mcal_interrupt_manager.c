@@ -1,168 +1,523 @@
-/* 
- * File:   mcal_interrupt_manager.c
- * Author: yousg
- *
- * Created on March 10, 2025, 4:57 PM
- */
-#include "mcal_interrupt_manager.h"
-
-static volatile uint8 RB4_Flag = 1;
-static volatile uint8 RB5_Flag = 1; 
-static volatile uint8 RB6_Flag = 1;
-static volatile uint8 RB7_Flag = 1;
-
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-
-void __interrupt() InterruptManagerHigh(void)
-{
-    if((INTCONbits.INT0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF))    
-    {
-        INT0_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCON3bits.INT2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF))    
-    {
-        INT2_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-
-void __interrupt(low_priority) InterruptManagerLow(void)
-{
-    if((INTCON3bits.INT1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF))    
-    {
-        INT1_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-
-#else
-
-void __interrupt() InterruptManagerHigh(void)
-{
-    if((INTCONbits.INT0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF))    
-    {
-        INT0_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCON3bits.INT1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF))    
-    {
-        INT1_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCON3bits.INT2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF))    
-    {
-        INT2_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((PIE1bits.ADIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.ADIF))    
-    {
-        ADC_ISR();
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    /*===================PORTB external on change interrupt======================*/
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-       (PORTBbits.RB4 == GPIO_HIGH) && (RB4_Flag == 1))    
-    {
-        RB4_Flag = 0;
-        RB4_ISR(0);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) &&           
-        (PORTBbits.RB4 == GPIO_LOW) && (RB4_Flag == 0))    
-        
-    {
-        RB4_Flag = 1;
-        RB4_ISR(1);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB5 == GPIO_HIGH) && (RB5_Flag = 1))    
-    {
-        RB5_Flag = 0;
-        RB5_ISR(0);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB5 == GPIO_LOW) && (RB5_Flag = 0))    
-    {
-        RB5_Flag = 1;
-        RB5_ISR(1);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB6 == GPIO_HIGH) && (RB6_Flag = 1))    
-    {
-        RB6_Flag = 0;
-        RB6_ISR(0);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB6 == GPIO_LOW) && (RB6_Flag = 0))    
-    {
-        RB6_Flag = 1;
-        RB6_ISR(1);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB7 == GPIO_HIGH) && (RB7_Flag = 1))    
-    {
-        RB7_Flag = 0;
-        RB7_ISR(0);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
-        (PORTBbits.RB7 == GPIO_LOW) && (RB7_Flag = 0))    
-    {
-        RB7_Flag = 1;
-        RB7_ISR(1);
-    }
-    else
-    {
-        /*Nothing*/
-    }
-}
-
-#endif
\ No newline at end of file
+/* 
+ * File:   mcal_interrupt_manager.c
+ * Author: yousg
+ *
+ * Created on March 10, 2025, 4:57 PM
+ */
+#include "mcal_interrupt_manager.h"
+
+static volatile uint8 RB4_Flag = 1;
+static volatile uint8 RB5_Flag = 1; 
+static volatile uint8 RB6_Flag = 1;
+static volatile uint8 RB7_Flag = 1;
+
+#if INTERRUPT_COUNTERS_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+static volatile uint16 interrupt_counters[INTERRUPT_SOURCE_COUNT];
+#define INTERRUPT_COUNT(_SOURCE)    (interrupt_counters[_SOURCE]++)
+#else
+#define INTERRUPT_COUNT(_SOURCE)
+#endif
+
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+
+void __interrupt() InterruptManagerHigh(void)
+{
+    if((INTCONbits.INT0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT0);
+        INT0_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCON3bits.INT2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT2);
+        INT2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.RCIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.RCIF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.RCIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_RX);
+        EUSART_RX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TXIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TXIF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.TXIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_TX);
+        EUSART_TX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.TMR0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF) &&
+       (INTERRUPT_HIGH_PRIORITY == INTCON2bits.TMR0IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER0);
+        TMR0_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR1IF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.TMR1IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER1);
+        TMR1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.TMR2IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER2);
+        TMR2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.TMR3IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR2bits.TMR3IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER3);
+        TMR3_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.CCP1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.CCP1IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP1);
+        CCP1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.CCP2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR2bits.CCP2IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP2);
+        CCP2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.SSPIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.SSPIF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR1bits.SSPIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_MSSP);
+        MSSP_I2C_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.BCLIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.BCLIF) &&
+       (INTERRUPT_HIGH_PRIORITY == IPR2bits.BCLIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_BUS_COLLISION);
+        MSSP_I2C_BUS_COL_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+
+void __interrupt(low_priority) InterruptManagerLow(void)
+{
+    if((INTCON3bits.INT1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT1);
+        INT1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.RCIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.RCIF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.RCIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_RX);
+        EUSART_RX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TXIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TXIF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.TXIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_TX);
+        EUSART_TX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.TMR0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF) &&
+       (INTERRUPT_LOW_PRIORITY == INTCON2bits.TMR0IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER0);
+        TMR0_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR1IF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.TMR1IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER1);
+        TMR1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.TMR2IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER2);
+        TMR2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.TMR3IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR2bits.TMR3IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER3);
+        TMR3_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.CCP1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.CCP1IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP1);
+        CCP1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.CCP2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR2bits.CCP2IP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP2);
+        CCP2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.SSPIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.SSPIF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR1bits.SSPIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_MSSP);
+        MSSP_I2C_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.BCLIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.BCLIF) &&
+       (INTERRUPT_LOW_PRIORITY == IPR2bits.BCLIP))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_BUS_COLLISION);
+        MSSP_I2C_BUS_COL_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+
+#else
+
+void __interrupt() InterruptManagerHigh(void)
+{
+    if((INTCONbits.INT0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.INT0IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT0);
+        INT0_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCON3bits.INT1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT1IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT1);
+        INT1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCON3bits.INT2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCON3bits.INT2IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_INT2);
+        INT2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.ADIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.ADIF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_ADC);
+        ADC_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.RCIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.RCIF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_RX);
+        EUSART_RX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TXIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TXIF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_EUSART_TX);
+        EUSART_TX_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.TMR0IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.TMR0IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER0);
+        TMR0_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR1IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER1);
+        TMR1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.TMR2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.TMR2IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER2);
+        TMR2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.TMR3IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.TMR3IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_TIMER3);
+        TMR3_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.CCP1IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.CCP1IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP1);
+        CCP1_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.CCP2IE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.CCP2IF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_CCP2);
+        CCP2_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE1bits.SSPIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR1bits.SSPIF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_MSSP);
+        MSSP_I2C_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((PIE2bits.BCLIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == PIR2bits.BCLIF))    
+    {
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_BUS_COLLISION);
+        MSSP_I2C_BUS_COL_ISR();
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    /*===================PORTB external on change interrupt======================*/
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+       (PORTBbits.RB4 == GPIO_HIGH) && (RB4_Flag == 1))    
+    {
+        RB4_Flag = 0;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB4_ISR(0);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) &&           
+        (PORTBbits.RB4 == GPIO_LOW) && (RB4_Flag == 0))    
+        
+    {
+        RB4_Flag = 1;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB4_ISR(1);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB5 == GPIO_HIGH) && (RB5_Flag = 1))    
+    {
+        RB5_Flag = 0;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB5_ISR(0);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB5 == GPIO_LOW) && (RB5_Flag = 0))    
+    {
+        RB5_Flag = 1;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB5_ISR(1);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB6 == GPIO_HIGH) && (RB6_Flag = 1))    
+    {
+        RB6_Flag = 0;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB6_ISR(0);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB6 == GPIO_LOW) && (RB6_Flag = 0))    
+    {
+        RB6_Flag = 1;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB6_ISR(1);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB7 == GPIO_HIGH) && (RB7_Flag = 1))    
+    {
+        RB7_Flag = 0;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB7_ISR(0);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+    if((INTCONbits.RBIE == INTERRUPT_ENABLE) && (INTERRUPT_OCCUR == INTCONbits.RBIF) && 
+        (PORTBbits.RB7 == GPIO_LOW) && (RB7_Flag = 0))    
+    {
+        RB7_Flag = 1;
+        INTERRUPT_COUNT(INTERRUPT_SOURCE_RB);
+        RB7_ISR(1);
+    }
+    else
+    {
+        /*Nothing*/
+    }
+}
+
+#endif
+
+#if INTERRUPT_COUNTERS_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief get how many times the ISR of a source was dispatched(wraps at 65535).
+ * @param source the interrupt source.
+ * @param count pointer to store the count.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType Interrupt_GetCount(interrupt_source_t source , uint16 *count)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == count) || (source >= INTERRUPT_SOURCE_COUNT))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*The counters are written by the ISRs, read until two reads agree*/
+        do
+        {
+            *count = interrupt_counters[source];
+        }while(*count != interrupt_counters[source]);
+    }
+    return ret;
+}
+
+/**
+ * @brief reset all the ISR counters.
+ * @return E_OK always.
+ */
+Std_ReturnType Interrupt_ClearCounts(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_counter = 0;
+    for(l_counter = 0 ; l_counter < INTERRUPT_SOURCE_COUNT ; l_counter++)
+    {
+        interrupt_counters[l_counter] = 0;
+    }
+    return ret;
+}
+#endif
@@ -1,33 +1,70 @@
-/* 
- * File:   mcal_interrupt_manager.h
- * Author: yousg
- *
- * Created on March 10, 2025, 4:57 PM
- */
-
-#ifndef MCAL_INTERRUPT_MANAGER_H
-#define	MCAL_INTERRUPT_MANAGER_H
-
-/******************Section: Includes**********************/
-#include "mcal_interrupt_cfg.h"
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-void INT0_ISR(void);
-void INT1_ISR(void);
-void INT2_ISR(void);
-
-void ADC_ISR(void);
-
-void RB4_ISR(uint8 RB4_Source);
-void RB5_ISR(uint8 RB5_Source);
-void RB6_ISR(uint8 RB6_Source);
-void RB7_ISR(uint8 RB7_Source);
-
-#endif	/* MCAL_INTERRUPT_MANAGER_H */
-
+/* 
+ * File:   mcal_interrupt_manager.h
+ * Author: yousg
+ *
+ * Created on March 10, 2025, 4:57 PM
+ */
+
+#ifndef MCAL_INTERRUPT_MANAGER_H
+#define	MCAL_INTERRUPT_MANAGER_H
+
+/******************Section: Includes**********************/
+#include "mcal_interrupt_cfg.h"
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    INTERRUPT_SOURCE_INT0 = 0,
+    INTERRUPT_SOURCE_INT1,
+    INTERRUPT_SOURCE_INT2,
+    INTERRUPT_SOURCE_RB,
+    INTERRUPT_SOURCE_ADC,
+    INTERRUPT_SOURCE_EUSART_RX,
+    INTERRUPT_SOURCE_EUSART_TX,
+    INTERRUPT_SOURCE_TIMER3,
+    INTERRUPT_SOURCE_MSSP,
+    INTERRUPT_SOURCE_BUS_COLLISION,
+    INTERRUPT_SOURCE_CCP1,
+    INTERRUPT_SOURCE_CCP2,
+    INTERRUPT_SOURCE_TIMER2,
+    INTERRUPT_SOURCE_TIMER1,
+    INTERRUPT_SOURCE_TIMER0,
+    INTERRUPT_SOURCE_COUNT
+}interrupt_source_t;
+
+/******************Section: Functions Declarations********/
+void INT0_ISR(void);
+void INT1_ISR(void);
+void INT2_ISR(void);
+
+void ADC_ISR(void);
+
+void EUSART_TX_ISR(void);
+void EUSART_RX_ISR(void);
+
+void TMR0_ISR(void);
+void TMR1_ISR(void);
+void TMR2_ISR(void);
+void TMR3_ISR(void);
+
+void CCP1_ISR(void);
+void CCP2_ISR(void);
+
+void MSSP_I2C_ISR(void);
+void MSSP_I2C_BUS_COL_ISR(void);
+
+void RB4_ISR(uint8 RB4_Source);
+void RB5_ISR(uint8 RB5_Source);
+void RB6_ISR(uint8 RB6_Source);
+void RB7_ISR(uint8 RB7_Source);
+
+#if INTERRUPT_COUNTERS_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType Interrupt_GetCount(interrupt_source_t source , uint16 *count);
+Std_ReturnType Interrupt_ClearCounts(void);
+#endif
+
+#endif	/* MCAL_INTERRUPT_MANAGER_H */
+
@@ -1,64 +1,67 @@
-/* 
- * File:   hal_timer2.h
- * Author: Yousab Gamal
- * Created on March 29, 2025, 1:39 PM
- */
-
-#ifndef HAL_TIMER2_H
-#define	HAL_TIMER2_H
-
-/******************Section: Includes**********************/
-#include <xc.h>
-#include "../mcal_std_types.h"
-#include "../../MCAL_Layer/GPIO/hal_gpio.h"
-#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
-
-/******************Section: Macros Declarations***********/
-#define TIMER2_POSTSCALER_DIV_BY_1         0
-#define TIMER2_POSTSCALER_DIV_BY_2         1
-#define TIMER2_POSTSCALER_DIV_BY_3         2
-#define TIMER2_POSTSCALER_DIV_BY_4         3
-#define TIMER2_POSTSCALER_DIV_BY_5         4
-#define TIMER2_POSTSCALER_DIV_BY_6         5
-#define TIMER2_POSTSCALER_DIV_BY_7         6
-#define TIMER2_POSTSCALER_DIV_BY_8         7
-#define TIMER2_POSTSCALER_DIV_BY_9         8
-#define TIMER2_POSTSCALER_DIV_BY_10        9
-#define TIMER2_POSTSCALER_DIV_BY_11        10
-#define TIMER2_POSTSCALER_DIV_BY_12        11
-#define TIMER2_POSTSCALER_DIV_BY_13        12
-#define TIMER2_POSTSCALER_DIV_BY_14        13
-#define TIMER2_POSTSCALER_DIV_BY_15        14
-#define TIMER2_POSTSCALER_DIV_BY_16        15
-
-#define TIMER2_PRESCALER_DIV_BY_1          0
-#define TIMER2_PRESCALER_DIV_BY_4          1
-#define TIMER2_PRESCALER_DIV_BY_16         2
-
-/******************Section: Macros Functions Declarations*/
-#define TIMER2_MODULE_ENABLE()              (T2CONbits.TMR2ON = 1)
-#define TIMER2_MODULE_DISABLE()             (T2CONbits.TMR2ON = 0)
-
-#define TIMER2_PRESCALER_SELECT(PRESCALER_VALUE)    (T2CONbits.T2CKPS = PRESCALER_VALUE)
-#define TIMER2_POSTSCALER_SELECT(POSTSCALER_VALUE)  (T2CONbits.TOUTPS = POSTSCALER_VALUE)
-
-/******************Section: Data Types Declarations*******/
-typedef struct{
-#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    void(*TIMER2_InterruptHandler)(void);
-    interrupt_priority_cfg priority; 
-#endif
-    uint8 timer2_preload_value;
-    uint8 postscaler_value     : 4;
-    uint8 prescaler_value      : 2;
-    uint8 timer2_reserved      : 2;
-}timer2_t;
-
-/******************Section: Functions Declarations********/
-Std_ReturnType Timer2_Init(const timer2_t * timer);
-Std_ReturnType Timer2_DeInit(const timer2_t * timer);
-Std_ReturnType Timer2_Write_Value(const timer2_t * timer , uint8 value);
-Std_ReturnType Timer2_Read_Value(const timer2_t * timer , uint8  *value);
-
-#endif	/* HAL_TIMER2_H */
-
+/* 
+ * File:   hal_timer2.h
+ * Author: Yousab Gamal
+ * Created on March 29, 2025, 1:39 PM
+ */
+
+#ifndef HAL_TIMER2_H
+#define	HAL_TIMER2_H
+
+/******************Section: Includes**********************/
+#include <xc.h>
+#include "../mcal_std_types.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
+
+/******************Section: Macros Declarations***********/
+#define TIMER2_POSTSCALER_DIV_BY_1         0
+#define TIMER2_POSTSCALER_DIV_BY_2         1
+#define TIMER2_POSTSCALER_DIV_BY_3         2
+#define TIMER2_POSTSCALER_DIV_BY_4         3
+#define TIMER2_POSTSCALER_DIV_BY_5         4
+#define TIMER2_POSTSCALER_DIV_BY_6         5
+#define TIMER2_POSTSCALER_DIV_BY_7         6
+#define TIMER2_POSTSCALER_DIV_BY_8         7
+#define TIMER2_POSTSCALER_DIV_BY_9         8
+#define TIMER2_POSTSCALER_DIV_BY_10        9
+#define TIMER2_POSTSCALER_DIV_BY_11        10
+#define TIMER2_POSTSCALER_DIV_BY_12        11
+#define TIMER2_POSTSCALER_DIV_BY_13        12
+#define TIMER2_POSTSCALER_DIV_BY_14        13
+#define TIMER2_POSTSCALER_DIV_BY_15        14
+#define TIMER2_POSTSCALER_DIV_BY_16        15
+
+#define TIMER2_PRESCALER_DIV_BY_1          0
+#define TIMER2_PRESCALER_DIV_BY_4          1
+#define TIMER2_PRESCALER_DIV_BY_16         2
+
+/******************Section: Macros Functions Declarations*/
+#define TIMER2_MODULE_ENABLE()              (T2CONbits.TMR2ON = 1)
+#define TIMER2_MODULE_DISABLE()             (T2CONbits.TMR2ON = 0)
+
+#define TIMER2_PRESCALER_SELECT(PRESCALER_VALUE)    (T2CONbits.T2CKPS = PRESCALER_VALUE)
+#define TIMER2_POSTSCALER_SELECT(POSTSCALER_VALUE)  (T2CONbits.TOUTPS = POSTSCALER_VALUE)
+
+/******************Section: Data Types Declarations*******/
+typedef struct{
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    void(*TIMER2_InterruptHandler)(void);
+    interrupt_priority_cfg priority; 
+#endif
+    uint8 timer2_preload_value;
+    uint8 postscaler_value     : 4;
+    uint8 prescaler_value      : 2;
+    uint8 timer2_reserved      : 2;
+}timer2_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType Timer2_Init(const timer2_t * timer);
+Std_ReturnType Timer2_DeInit(const timer2_t * timer);
+Std_ReturnType Timer2_Write_Value(const timer2_t * timer , uint8 value);
+Std_ReturnType Timer2_Read_Value(const timer2_t * timer , uint8  *value);
+#if TIMER2_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType Timer2_Set_Period_Match_Hook(void(*hook)(void));
+#endif
+
+#endif	/* HAL_TIMER2_H */
+
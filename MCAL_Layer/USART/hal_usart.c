@@ -1,405 +1,1452 @@
-/* 
- * File:   hal_usart.c
- * Author: Yousab Gamal
- * Created on April 5, 2025, 2:24 PM
- */
-
-#include "hal_usart.h"
-
-#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    static void(*EUSART_TxInterruptHandler)(void) = NULL;
-#endif
-#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    static void(*EUSART_RxInterruptHandler)(void) = NULL;
-    static void(*EUSART_FramingErrorHandler)(void) = NULL;
-    static void(*EUSART_OverrunErrorHandler)(void) = NULL;
-#endif
-
-static void EUSART_Baud_Rate_Calc(const usart_t *eusart);
-static void EUSART_ASYNCH_TX_Init(const usart_t *eusart);
-static void EUSART_ASYNCH_RX_Init(const usart_t *eusart);
-
-/**
- * @brief initialize EUSART.
- * @param eusart pointer points to usart_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType EUSART_ASYNCH_Init(const usart_t *eusart)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == eusart)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        EUSART_MODULE_DISABLE();
-        TRISCbits.RC7 = 1;
-        TRISCbits.RC6 = 1;
-        EUSART_Baud_Rate_Calc(eusart);
-        EUSART_ASYNCH_TX_Init(eusart);
-        EUSART_ASYNCH_RX_Init(eusart);
-        EUSART_MODULE_ENABLE();
-    }
-    return ret;
-}
-
-/**
- * @brief de initialize EUSART module.
- * @param eusart pointer points to usart_t data.
- * @return...
- *           E_OK: means function done without any errors.
- *           E_NOT_OK: means there is an error during run the function.
- */
-Std_ReturnType EUSART_ASYNCH_DeInit(const usart_t *eusart)
-{
-    Std_ReturnType ret = E_OK;
-    if(NULL == eusart)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        EUSART_MODULE_DISABLE();
-    }
-    return ret;
-}
-
-/**
- * @brief read the value in RCREG register and store it in data.
- * @param data is a char.
- */
-void EUSART_ASYNCH_ReadByteBlocking(uint8 *data)
-{
-    while(!PIR1bits.RCIF);//blocking
-    *data = RCREG;
-}
-
-/**
- * 
- * @param data is a char.
- */
-void EUSART_ASYNCH_ReadByteNonBlocking(uint8 *data)
-{
-    if(1 == PIR1bits.RCIF)//non_blocking
-    {
-        *data = RCREG;
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-/**
- * @brief restart the EUSART module.
- */
-void EUSART_ASYNCH_RX_Restart(void)
-{
-    RCSTAbits.CREN = 0;
-    RCSTAbits.CREN = 1;
-}
-
-/**
- * @brief write data(char) in TXREG register.
- * @param data is a char. 
- */
-void EUSART_ASYNCH_WriteByteBlocking(uint8 data)
-{
-    while(!TXSTAbits.TRMT);//bloking
-#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-    EUSART_TX_InterruptEnable();
-#endif
-    TXREG = data;
-}
-
-/**
- * @brief write data(char) in TXREG register.
- * @param data is a char.
- */
-void EUSART_ASYNCH_WriteByteNonBlocking(uint8 data)
-{
-    if(TXSTAbits.TRMT)
-    {
-        TXREG = data;
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-/**
- * @brief write data(string) char by char in TXREG register.
- * @param data an array of characters.
- * @param string_length the length of the string.
- */
-Std_ReturnType EUSART_ASYNCH_WriteStringNonBlocking(uint8 *data , uint16 string_length)
-{
-    Std_ReturnType ret = E_OK;
-    uint16 l_char_counter = 0;
-    if(NULL == data)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        for(l_char_counter = 0 ; l_char_counter < string_length ; l_char_counter++)
-        {
-            EUSART_ASYNCH_WriteByteNonBlocking(data[l_char_counter]); 
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief write data(string) char by char in TXREG register.
- * @param data an array of characters.
- * @param string_length the length of the string.
- */
-Std_ReturnType EUSART_ASYNCH_WriteStringBlocking(uint8 *data , uint16 string_length)
-{
-    Std_ReturnType ret = E_OK;
-    uint16 l_char_counter = 0;
-    if(NULL == data)
-    {
-        ret = E_NOT_OK;
-    }
-    else
-    {
-        for(l_char_counter = 0 ; l_char_counter < string_length ; l_char_counter++)
-        {
-            EUSART_ASYNCH_WriteByteBlocking(data[l_char_counter]); 
-        }
-    }
-    return ret;
-}
-
-/**
- * @brief calculate and initialize baud rate in the two registers...
- *        TXSTA(SYNC bit & BRGH bit) and BAUDCON(BRG16 bit).
- * @param eusart pointer points to usart_t data.
- */
-static void EUSART_Baud_Rate_Calc(const usart_t *eusart)
-{
-    float Baud_Rate_Temp = 0;
-    switch(eusart -> baudrate_gen_cfg)
-    {
-        case BAUDRATE_ASYNCH_8BIT_LOW_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCH_LOW_SPEED;
-            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 64)- 1);
-            break;
-        case BAUDRATE_ASYNCH_8BIT_HIGH_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCH_HIGH_SPEED;
-            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 16)- 1);
-            break;
-        case BAUDRATE_ASYNCH_16BIT_LOW_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCH_LOW_SPEED;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 16)- 1);
-            break;
-        case BAUDRATE_ASYNCH_16BIT_HIGH_SPEED:
-            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
-            TXSTAbits.BRGH = EUSART_ASYNCH_HIGH_SPEED;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 4)- 1);
-            break;  
-        case BAUDRATE_SYNCH_8BIT:
-            TXSTAbits.SYNC = EUSART_SYNCH_MODE;
-            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 4)- 1);
-            break; 
-        case BAUDRATE_SYNCH_16BIT:
-            TXSTAbits.SYNC = EUSART_SYNCH_MODE;
-            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
-            Baud_Rate_Temp = (((_XTAL_FREQ / (float)eusart -> baudrate)/ 4)- 1);
-            break;   
-        default:
-            /*NOTHING*/
-            break;
-    }
-    SPBRG = (uint8)((uint32)Baud_Rate_Temp );
-    SPBRGH = (uint8)((uint32)Baud_Rate_Temp >> 8);
-}
-
-/**
- * @brief initialize TX with the desired values.
- * @param eusart pointer points to usart_t data.
- */
-static void EUSART_ASYNCH_TX_Init(const usart_t *eusart)
-{
-    if(EUSART_ASYNCH_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_enable)
-    {
-        TXSTAbits.TXEN = EUSART_ASYNCH_TX_ENABLE;
-        /*EUSART transmitter interrupt configuration*/
-        if(EUSART_ASYNCH_INTERRUPT_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_interrupt_enable)
-        {
-            PIE1bits.TXIE = EUSART_ASYNCH_INTERRUPT_TX_ENABLE;
-#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-            EUSART_TX_InterruptEnable();
-            EUSART_TxInterruptHandler = eusart -> EUSART_TxInterruptHandler;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-            INTERRUPT_PriorityLevelEnable();
-            if(INTERRUPT_HIGH_PRIORITY == eusart -> usart_tx_cfg.usart_tx_priority)
-            {
-                INTERRUPT_GlobalInterruptHighEnable();
-                EUSART_TX_HighPrioritySet();
-            }
-            else if(INTERRUPT_LOW_PRIORITY == eusart -> usart_tx_cfg.usart_tx_priority)
-            {
-                INTERRUPT_GlobalInterruptLowEnable();
-                EUSART_RX_LowPrioritySet();
-            }
-            else
-            {
-                /*NOTHING*/
-            }
-#else
-            INTERRUPT_GlobalInterruptEnable();
-            INTERRUPT_PeripheralInterruptEnable();
-#endif
-#endif
-        }
-        else if(EUSART_ASYNCH_INTERRUPT_TX_DISABLE == eusart -> usart_tx_cfg.usart_tx_interrupt_enable)
-        {
-            PIE1bits.TXIE = EUSART_ASYNCH_INTERRUPT_TX_DISABLE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-        /*EUSART 9-bit transmitter configuration*/
-        if(EUSART_ASYNCH_9BIT_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_9bit_enable)
-        {
-            TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_ENABLE;
-        }
-        else if(EUSART_ASYNCH_9BIT_TX_DISABLE == eusart -> usart_tx_cfg.usart_tx_9bit_enable)
-        {
-            TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_DISABLE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-/**
- * @brief initialize RX with the desired values.
- * @param eusart
- */
-static void EUSART_ASYNCH_RX_Init(const usart_t *eusart)
-{
-    if(EUSART_ASYNCH_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_enable)
-    {
-        RCSTAbits.CREN = EUSART_ASYNCH_RX_ENABLE;
-        /*EUSART receiver interrupt configuration*/
-        if(EUSART_ASYNCH_INTERRUPT_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_interrupt_enable)
-        {
-            PIE1bits.RCIE = EUSART_ASYNCH_INTERRUPT_RX_ENABLE;
-#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
-            EUSART_RX_InterruptEnable();
-            EUSART_RxInterruptHandler = eusart -> EUSART_RxInterruptHandler;
-            EUSART_FramingErrorHandler = eusart -> EUSART_FramingErrorHandler;
-            EUSART_OverrunErrorHandler = eusart -> EUSART_OverrunErrorHandler;
-#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
-            INTERRUPT_PriorityLevelEnable();
-            if(INTERRUPT_HIGH_PRIORITY == eusart -> usart_rx_cfg.usart_rx_priority)
-            {
-                INTERRUPT_GlobalInterruptHighEnable();
-                EUSART_RX_HighPrioritySet();
-            }
-            else if(INTERRUPT_LOW_PRIORITY == eusart -> usart_rx_cfg.usart_rx_priority)
-            {
-                INTERRUPT_GlobalInterruptLowEnable();
-                EUSART_RX_LowPrioritySet();
-            }
-            else
-            {
-                /*NOTHING*/
-            }
-#else
-            INTERRUPT_GlobalInterruptEnable();
-            INTERRUPT_PeripheralInterruptEnable();
-#endif
-#endif
-        }
-        else if(EUSART_ASYNCH_INTERRUPT_RX_DISABLE == eusart -> usart_rx_cfg.usart_rx_interrupt_enable)
-        {
-            PIE1bits.RCIE = EUSART_ASYNCH_INTERRUPT_RX_DISABLE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-        /*EUSART 9-bit receiver configuration*/
-        if(EUSART_ASYNCH_9BIT_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_9bit_enable)
-        {
-            RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_ENABLE;
-        }
-        else if(EUSART_ASYNCH_9BIT_RX_DISABLE == eusart -> usart_rx_cfg.usart_rx_9bit_enable)
-        {
-            RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_DISABLE;
-        }
-        else
-        {
-            /*NOTHING*/
-        }
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-void EUSART_TX_ISR()
-{
-    EUSART_TX_InterruptDisable();
-    if(EUSART_TxInterruptHandler)
-    {
-       EUSART_TxInterruptHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
-
-void EUSART_RX_ISR()
-{
-    if(EUSART_RxInterruptHandler)
-    {
-       EUSART_RxInterruptHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-    if(EUSART_FramingErrorHandler)
-    {
-       EUSART_FramingErrorHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-    if(EUSART_OverrunErrorHandler)
-    {
-       EUSART_OverrunErrorHandler();
-    }
-    else
-    {
-        /*NOTHING*/
-    }
-}
\ No newline at end of file
+/* 
+ * File:   hal_usart.c
+ * Author: Yousab Gamal
+ * Created on April 5, 2025, 2:24 PM
+ */
+
+#include "hal_usart.h"
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    static void(*EUSART_TxInterruptHandler)(void) = NULL;
+    static const uint8 *eusart_tx_buffer = NULL;
+    static volatile uint16 eusart_tx_length = 0;
+    static volatile uint16 eusart_tx_index = 0;    /*Written by the TX ISR only*/
+#endif
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    static void(*EUSART_RxInterruptHandler)(void) = NULL;
+    static void(*EUSART_FramingErrorHandler)(void) = NULL;
+    static void(*EUSART_OverrunErrorHandler)(void) = NULL;
+#endif
+
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    static volatile uint8 eusart_rx_buffer[EUSART_CFG_RX_BUFFER_SIZE];
+    static volatile uint8 eusart_rx_head = 0;   /*Written by the RX ISR only*/
+    static volatile uint8 eusart_rx_tail = 0;   /*Written by the readers only*/
+    static volatile uint8 eusart_rx_buffered = 0;
+    static volatile usart_rx_statistics_t eusart_rx_statistics = {0};
+    static void(*EUSART_RxByteHandler)(uint8 data) = NULL;
+    static usart_error_status_t EUSART_RX_Buffer_Fill(void);
+#endif
+
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+    static volatile usart_autobaud_state_t eusart_autobaud_state = EUSART_AUTOBAUD_IDLE;
+    static volatile uint8 eusart_autobaud_overflows = 0;
+    static void EUSART_AutoBaud_Complete(void);
+#endif
+
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+    static pin_config_t eusart_de_pin;
+    static uint8 eusart_de_pin_used = 0;
+    static uint8 eusart_node_address = 0;
+    static uint8 eusart_address_detect = 0;
+    static volatile uint8 eusart_selected_address = 0;
+    static volatile uint8 eusart_de_release_pending = 0;    /*A filler byte is queued, DE drops when it moves*/
+    static void EUSART_Multidrop_Init(const usart_t *eusart);
+    static void EUSART_Multidrop_Address(uint8 address);
+    static void EUSART_Multidrop_DriverDisable(void);
+#endif
+
+#if EUSART_CFG_SYNCH_MASTER == EUSART_CFG_FEATURE_ENABLE
+    /*Bit reversed nibbles, the EUSART shifts LSB first*/
+    static const uint8 eusart_nibble_reverse[16] = {
+        0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A, 0x06, 0x0E,
+        0x01, 0x09, 0x05, 0x0D, 0x03, 0x0B, 0x07, 0x0F
+    };
+    static uint8 eusart_synch_msb_first = 0;
+#endif
+
+typedef struct{
+    uint8 divisor;
+    uint8 brgh  : 1;
+    uint8 brg16 : 1;
+}eusart_brg_setting_t;
+
+/*Asynchronous generator settings, finest resolution first*/
+static const eusart_brg_setting_t eusart_brg_settings[] = {
+    {.divisor = EUSART_BRG_DIV_16BIT_HIGH_SPEED , .brgh = EUSART_ASYNCH_HIGH_SPEED , .brg16 = EUSART_16BIT_BAUDRATE_GEN},
+    {.divisor = EUSART_BRG_DIV_16BIT_LOW_SPEED  , .brgh = EUSART_ASYNCH_LOW_SPEED  , .brg16 = EUSART_16BIT_BAUDRATE_GEN},
+    {.divisor = EUSART_BRG_DIV_8BIT_HIGH_SPEED  , .brgh = EUSART_ASYNCH_HIGH_SPEED , .brg16 = EUSART_8BIT_BAUDRATE_GEN},
+    {.divisor = EUSART_BRG_DIV_8BIT_LOW_SPEED   , .brgh = EUSART_ASYNCH_LOW_SPEED  , .brg16 = EUSART_8BIT_BAUDRATE_GEN},
+};
+
+/*Standard rates tried by EUSART_ASYNCH_GetFastestBaudrate, fastest first*/
+static const uint32 eusart_standard_baudrates[] = {
+    115200UL , 57600UL , 38400UL , 19200UL , 9600UL , 4800UL , 2400UL , 1200UL
+};
+
+static void EUSART_Baud_Rate_Calc(const usart_t *eusart);
+static uint32 EUSART_Baudrate_Select(uint32 baudrate , uint8 *setting_index , uint16 *brg_value);
+static void EUSART_ASYNCH_TX_Init(const usart_t *eusart);
+static void EUSART_ASYNCH_RX_Init(const usart_t *eusart);
+
+/**
+ * @brief initialize EUSART.
+ * @param eusart pointer points to usart_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_Init(const usart_t *eusart)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == eusart)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_MODULE_DISABLE();
+        TRISCbits.RC7 = 1;
+        TRISCbits.RC6 = 1;
+        EUSART_Baud_Rate_Calc(eusart);
+        EUSART_ASYNCH_TX_Init(eusart);
+        EUSART_ASYNCH_RX_Init(eusart);
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+        EUSART_Multidrop_Init(eusart);
+#endif
+        EUSART_MODULE_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief de initialize EUSART module.
+ * @param eusart pointer points to usart_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_DeInit(const usart_t *eusart)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == eusart)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_MODULE_DISABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief read the value in RCREG register and store it in data.
+ * @param data is a char.
+ */
+void EUSART_ASYNCH_ReadByteBlocking(uint8 *data)
+{
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    if(eusart_rx_buffered)
+    {
+        while(eusart_rx_head == eusart_rx_tail);//blocking
+        *data = eusart_rx_buffer[eusart_rx_tail];
+        eusart_rx_tail = (eusart_rx_tail + 1) & EUSART_RX_BUFFER_MASK;
+    }
+    else
+    {
+        while(!PIR1bits.RCIF);//blocking
+        *data = RCREG;
+    }
+#else
+    while(!PIR1bits.RCIF);//blocking
+    *data = RCREG;
+#endif
+}
+
+/**
+ * 
+ * @param data is a char.
+ */
+void EUSART_ASYNCH_ReadByteNonBlocking(uint8 *data)
+{
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    if(eusart_rx_buffered)
+    {
+        /*The RX ISR owns RCREG, take the byte from the ring buffer*/
+        if(eusart_rx_head != eusart_rx_tail)//non_blocking
+        {
+            *data = eusart_rx_buffer[eusart_rx_tail];
+            eusart_rx_tail = (eusart_rx_tail + 1) & EUSART_RX_BUFFER_MASK;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else if(1 == PIR1bits.RCIF)//non_blocking
+    {
+        *data = RCREG;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#else
+    if(1 == PIR1bits.RCIF)//non_blocking
+    {
+        *data = RCREG;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#endif
+}
+
+/**
+ * @brief restart the EUSART module.
+ */
+void EUSART_ASYNCH_RX_Restart(void)
+{
+    RCSTAbits.CREN = 0;
+    RCSTAbits.CREN = 1;
+}
+
+/**
+ * @brief write data(char) in TXREG register.
+ * @param data is a char. 
+ */
+void EUSART_ASYNCH_WriteByteBlocking(uint8 data)
+{
+    while(!TXSTAbits.TRMT);//bloking
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    EUSART_TX_InterruptEnable();
+#endif
+    TXREG = data;
+}
+
+/**
+ * @brief std_format sink, streams formatted output through EUSART_ASYNCH_WriteByteBlocking.
+ * @param context unused.
+ * @param data is a char.
+ */
+void EUSART_ASYNCH_FormatSink(void *context , uint8 data)
+{
+    (void)context;
+    EUSART_ASYNCH_WriteByteBlocking(data);
+}
+
+/**
+ * @brief write data(char) in TXREG register.
+ * @param data is a char.
+ */
+void EUSART_ASYNCH_WriteByteNonBlocking(uint8 data)
+{
+    if(TXSTAbits.TRMT)
+    {
+        TXREG = data;
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+/**
+ * @brief write data(string) char by char in TXREG register.
+ * @param data an array of characters.
+ * @param string_length the length of the string.
+ */
+Std_ReturnType EUSART_ASYNCH_WriteStringNonBlocking(uint8 *data , uint16 string_length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_char_counter = 0;
+    if(NULL == data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_char_counter = 0 ; l_char_counter < string_length ; l_char_counter++)
+        {
+            EUSART_ASYNCH_WriteByteNonBlocking(data[l_char_counter]); 
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief write data(string) char by char in TXREG register.
+ * @param data an array of characters.
+ * @param string_length the length of the string.
+ */
+Std_ReturnType EUSART_ASYNCH_WriteStringBlocking(uint8 *data , uint16 string_length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_char_counter = 0;
+    if(NULL == data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_char_counter = 0 ; l_char_counter < string_length ; l_char_counter++)
+        {
+            EUSART_ASYNCH_WriteByteBlocking(data[l_char_counter]); 
+        }
+    }
+    return ret;
+}
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+/**
+ * @brief start sending a buffer from the TX interrupt and return immediately.
+ *        the buffer must stay unchanged until EUSART_ASYNCH_TX_Pending reports 0.
+ *        the transmitter interrupt must be enabled in usart_tx_cfg.
+ * @param data the bytes to send.
+ * @param length number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means a NULL/empty buffer or a transfer is still in progress.
+ */
+Std_ReturnType EUSART_ASYNCH_WriteBufferNonBlocking(const uint8 *data , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_pending = 0;
+    ret = EUSART_ASYNCH_TX_Pending(&l_pending);
+    if((NULL == data) || (0 == length) || (0 != l_pending))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_TX_InterruptDisable();
+        eusart_tx_buffer = data;
+        eusart_tx_length = length;
+        eusart_tx_index = 0;
+        /*TXIF is set while TXREG is empty, so the ISR loads the first byte*/
+        EUSART_TX_InterruptEnable();
+    }
+    return ret;
+}
+
+/**
+ * @brief get the number of bytes of the current buffer not yet loaded in TXREG.
+ *        multidrop: one more until the TX ISR has released the bus after the buffer.
+ * @param pending pointer to store the number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_TX_Pending(uint16 *pending)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_txie_status = 0;
+    if(NULL == pending)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*The TX ISR advances the index and resets both at the end of a buffer*/
+        l_txie_status = PIE1bits.TXIE;
+        EUSART_TX_InterruptDisable();
+        *pending = eusart_tx_length - eusart_tx_index;
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+        *pending += eusart_de_release_pending;
+#endif
+        PIE1bits.TXIE = l_txie_status;
+    }
+    return ret;
+}
+#endif
+
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief get the number of received bytes waiting in the RX ring buffer.
+ * @param available pointer to store the number of buffered bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_Available(uint16 *available)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == available)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *available = (uint8)(eusart_rx_head - eusart_rx_tail) & EUSART_RX_BUFFER_MASK;
+    }
+    return ret;
+}
+
+/**
+ * @brief copy up to length bytes from the RX ring buffer without waiting.
+ * @param data buffer to store the received bytes.
+ * @param length the maximum number of bytes to read.
+ * @param read_count pointer to store the number of bytes actually read.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_Read(uint8 *data , uint16 length , uint16 *read_count)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_counter = 0;
+    uint8 l_tail = 0;
+    if((NULL == data) || (NULL == read_count))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        l_tail = eusart_rx_tail;
+        while((l_counter < length) && (l_tail != eusart_rx_head))
+        {
+            data[l_counter] = eusart_rx_buffer[l_tail];
+            l_tail = (l_tail + 1) & EUSART_RX_BUFFER_MASK;
+            l_counter++;
+        }
+        eusart_rx_tail = l_tail;
+        *read_count = l_counter;
+    }
+    return ret;
+}
+
+/**
+ * @brief read the oldest buffered byte without removing it.
+ * @param data pointer to store the byte.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the buffer is empty or the pointer is NULL.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_Peek(uint8 *data)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == data) || (eusart_rx_head == eusart_rx_tail))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *data = eusart_rx_buffer[eusart_rx_tail];
+    }
+    return ret;
+}
+
+/**
+ * @brief discard every byte waiting in the RX ring buffer.
+ * @return E_OK always.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_Flush(void)
+{
+    Std_ReturnType ret = E_OK;
+    eusart_rx_tail = eusart_rx_head;
+    return ret;
+}
+
+/**
+ * @brief take a consistent snapshot of the receiver error counters.
+ * @param statistics pointer to store the counters.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_GetStatistics(usart_rx_statistics_t *statistics)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rcie_status = 0;
+    if(NULL == statistics)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*16-bit counters are updated by the ISR, block it while copying*/
+        l_rcie_status = PIE1bits.RCIE;
+        PIE1bits.RCIE = 0;
+        statistics -> framing_errors = eusart_rx_statistics.framing_errors;
+        statistics -> overrun_errors = eusart_rx_statistics.overrun_errors;
+        statistics -> buffer_overflows = eusart_rx_statistics.buffer_overflows;
+        PIE1bits.RCIE = l_rcie_status;
+    }
+    return ret;
+}
+
+/**
+ * @brief reset the receiver error counters.
+ * @return E_OK always.
+ */
+Std_ReturnType EUSART_ASYNCH_RX_ClearStatistics(void)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_rcie_status = PIE1bits.RCIE;
+    PIE1bits.RCIE = 0;
+    eusart_rx_statistics.framing_errors = 0;
+    eusart_rx_statistics.overrun_errors = 0;
+    eusart_rx_statistics.buffer_overflows = 0;
+    PIE1bits.RCIE = l_rcie_status;
+    return ret;
+}
+#endif
+
+/**
+ * @brief switch the asynchronous link to a new baud rate at runtime,
+ *        choosing the BRGH/BRG16 setting with the lowest error.
+ *        waits for the character being shifted out to complete.
+ * @param baudrate the new baud rate.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: the rate can not be generated within EUSART_CFG_BAUDRATE_MAX_ERROR.
+ */
+Std_ReturnType EUSART_ASYNCH_SetBaudrate(uint32 baudrate)
+{
+    Std_ReturnType ret = E_OK;
+    uint8 l_setting_index = 0;
+    uint16 l_brg_value = 0;
+    if((0 == baudrate) || 
+       (EUSART_Baudrate_Select(baudrate , &l_setting_index , &l_brg_value) > EUSART_CFG_BAUDRATE_MAX_ERROR))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(!TXSTAbits.TRMT);
+        TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+        TXSTAbits.BRGH = eusart_brg_settings[l_setting_index].brgh;
+        BAUDCONbits.BRG16 = eusart_brg_settings[l_setting_index].brg16;
+        SPBRGH = (uint8)(l_brg_value >> 8);
+        SPBRG = (uint8)l_brg_value;
+    }
+    return ret;
+}
+
+/**
+ * @brief calculate the baud rate currently generated by SPBRGH:SPBRG,
+ *        e.g. the value measured by the auto-baud detection.
+ * @param baudrate pointer to store the baud rate.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_GetBaudrate(uint32 *baudrate)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 l_divisor = 0;
+    uint32 l_divider = 0;
+    if(NULL == baudrate)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if(EUSART_SYNCH_MODE == TXSTAbits.SYNC)
+        {
+            l_divisor = EUSART_BRG_DIV_SYNCH;
+        }
+        else if(EUSART_16BIT_BAUDRATE_GEN == BAUDCONbits.BRG16)
+        {
+            l_divisor = (EUSART_ASYNCH_HIGH_SPEED == TXSTAbits.BRGH) ? 
+                        EUSART_BRG_DIV_16BIT_HIGH_SPEED : EUSART_BRG_DIV_16BIT_LOW_SPEED;
+        }
+        else
+        {
+            l_divisor = (EUSART_ASYNCH_HIGH_SPEED == TXSTAbits.BRGH) ? 
+                        EUSART_BRG_DIV_8BIT_HIGH_SPEED : EUSART_BRG_DIV_8BIT_LOW_SPEED;
+        }
+        if(EUSART_16BIT_BAUDRATE_GEN == BAUDCONbits.BRG16)
+        {
+            l_divider = ((uint32)SPBRGH << 8) + SPBRG + 1;
+        }
+        else
+        {
+            l_divider = (uint32)SPBRG + 1;
+        }
+        *baudrate = (_XTAL_FREQ + ((l_divisor * l_divider) / 2)) / (l_divisor * l_divider);
+    }
+    return ret;
+}
+
+/**
+ * @brief find the fastest standard baud rate not above the peer's limit
+ *        that this node can generate within EUSART_CFG_BAUDRATE_MAX_ERROR.
+ *        both sides calling it with each other's maximum agree on the same rate.
+ * @param peer_max_baudrate the maximum rate supported by the other side.
+ * @param baudrate pointer to store the negotiated rate.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: no common standard rate exists.
+ */
+Std_ReturnType EUSART_ASYNCH_GetFastestBaudrate(uint32 peer_max_baudrate , uint32 *baudrate)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8 l_counter = 0;
+    uint8 l_setting_index = 0;
+    uint16 l_brg_value = 0;
+    if(NULL != baudrate)
+    {
+        for(l_counter = 0 ; l_counter < (sizeof(eusart_standard_baudrates) / sizeof(uint32)) ; l_counter++)
+        {
+            if((eusart_standard_baudrates[l_counter] <= peer_max_baudrate) &&
+               (EUSART_Baudrate_Select(eusart_standard_baudrates[l_counter] , &l_setting_index , &l_brg_value)
+                <= EUSART_CFG_BAUDRATE_MAX_ERROR))
+            {
+                *baudrate = eusart_standard_baudrates[l_counter];
+                ret = E_OK;
+                break;
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    return ret;
+}
+
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief arm the auto-baud detection, the next received character must be
+ *        the 0x55 sync character, it is consumed by the measurement.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: the module is in synchronous mode.
+ */
+Std_ReturnType EUSART_ASYNCH_AutoBaud_Start(void)
+{
+    Std_ReturnType ret = E_OK;
+    if(EUSART_SYNCH_MODE == TXSTAbits.SYNC)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        BAUDCONbits.ABDOVF = EUSART_AUTOBAUD_OVERFLOW_CLEARED;
+        eusart_autobaud_overflows = 0;
+        eusart_autobaud_state = EUSART_AUTOBAUD_IN_PROGRESS;
+        EUSART_AUTOBAUD_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief abort a pending auto-baud detection.
+ * @return E_OK always.
+ */
+Std_ReturnType EUSART_ASYNCH_AutoBaud_Stop(void)
+{
+    Std_ReturnType ret = E_OK;
+    EUSART_AUTOBAUD_DISABLE();
+    eusart_autobaud_state = EUSART_AUTOBAUD_IDLE;
+    return ret;
+}
+
+/**
+ * @brief get the auto-baud detection state, when the RX interrupt is
+ *        disabled this call also completes the measurement.
+ * @param state pointer to store the state.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_AutoBaud_GetState(usart_autobaud_state_t *state)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == state)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        if((EUSART_AUTOBAUD_IN_PROGRESS == eusart_autobaud_state) && 
+           (0 == BAUDCONbits.ABDEN) && (0 == PIE1bits.RCIE))
+        {
+            EUSART_AutoBaud_Complete();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        *state = eusart_autobaud_state;
+    }
+    return ret;
+}
+
+/**
+ * @brief get how many measurements were restarted after an ABDOVF rollover.
+ * @param overflow_count pointer to store the count.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_ASYNCH_AutoBaud_GetOverflowCount(uint8 *overflow_count)
+{
+    Std_ReturnType ret = E_OK;
+    if(NULL == overflow_count)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *overflow_count = eusart_autobaud_overflows;
+    }
+    return ret;
+}
+#endif
+
+#if EUSART_CFG_SYNCH_MASTER == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief initialize EUSART as synchronous master(CK on RC6, DT on RC7).
+ *        baudrate_gen_cfg must be BAUDRATE_SYNCH_8BIT/16BIT, a baudrate of
+ *        _XTAL_FREQ / 4 or more gives SPBRG = 0, the fastest clock(Fosc/4).
+ *        the EUSART interrupts are disabled, transfers poll the flags because
+ *        a byte takes only 8 instruction cycles at Fosc/4.
+ * @param eusart pointer points to usart_t data.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_SYNCH_Master_Init(const usart_t *eusart)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == eusart) || 
+       ((BAUDRATE_SYNCH_8BIT != eusart -> baudrate_gen_cfg) && (BAUDRATE_SYNCH_16BIT != eusart -> baudrate_gen_cfg)))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_MODULE_DISABLE();
+        TRISCbits.RC7 = 1;
+        TRISCbits.RC6 = 1;
+        PIE1bits.TXIE = EUSART_ASYNCH_INTERRUPT_TX_DISABLE;
+        PIE1bits.RCIE = EUSART_ASYNCH_INTERRUPT_RX_DISABLE;
+        if(eusart -> baudrate >= (_XTAL_FREQ / EUSART_BRG_DIV_SYNCH))
+        {
+            TXSTAbits.SYNC = EUSART_SYNCH_MODE;
+            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
+            SPBRGH = 0;
+            SPBRG = 0;
+        }
+        else
+        {
+            EUSART_Baud_Rate_Calc(eusart);
+        }
+        TXSTAbits.CSRC = EUSART_SYNCH_MASTER;
+        BAUDCONbits.SCKP = eusart -> usart_synch_cfg.usart_clock_polarity;
+        eusart_synch_msb_first = eusart -> usart_synch_cfg.usart_bit_order;
+        TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_DISABLE;
+        RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_DISABLE;
+        RCSTAbits.CREN = 0;
+        RCSTAbits.SREN = 0;
+        TXSTAbits.TXEN = EUSART_ASYNCH_TX_ENABLE;
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+        eusart_rx_buffered = 0;
+#endif
+        EUSART_MODULE_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief shift a buffer out(e.g. into a 74HC595 chain) and wait until the
+ *        last bit left the shift register, so the latch can be pulsed next.
+ * @param data the bytes to send, data[0] first.
+ * @param length number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_SYNCH_Master_WriteBuffer(const uint8 *data , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_counter = 0;
+    uint8 l_data = 0;
+    if(NULL == data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        for(l_counter = 0 ; l_counter < length ; l_counter++)
+        {
+            l_data = data[l_counter];
+            if(eusart_synch_msb_first)
+            {
+                l_data = (uint8)((eusart_nibble_reverse[l_data & 0x0F] << 4) | eusart_nibble_reverse[l_data >> 4]);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            while(!PIR1bits.TXIF);//TXREG is double buffered, load while the previous byte shifts
+            TXREG = l_data;
+        }
+        NOP();/*TXIF/TRMT are valid from the second instruction cycle after the load*/
+        while(!TXSTAbits.TRMT);//blocking
+    }
+    return ret;
+}
+
+/**
+ * @brief clock bytes in(e.g. from a 74HC165 chain), one single receive(SREN) per byte.
+ *        the transmitter is disabled while receiving because DT is shared.
+ * @param data buffer to store the received bytes.
+ * @param length number of bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType EUSART_SYNCH_Master_ReadBuffer(uint8 *data , uint16 length)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_counter = 0;
+    uint8 l_data = 0;
+    if(NULL == data)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while(!TXSTAbits.TRMT);//finish a pending write
+        TXSTAbits.TXEN = EUSART_ASYNCH_TX_DISABLE;
+        for(l_counter = 0 ; l_counter < length ; l_counter++)
+        {
+            RCSTAbits.SREN = 1;/*Cleared by hardware after one byte*/
+            while(!PIR1bits.RCIF);//blocking
+            l_data = RCREG;
+            if(eusart_synch_msb_first)
+            {
+                l_data = (uint8)((eusart_nibble_reverse[l_data & 0x0F] << 4) | eusart_nibble_reverse[l_data >> 4]);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+            data[l_counter] = l_data;
+        }
+        TXSTAbits.TXEN = EUSART_ASYNCH_TX_ENABLE;
+    }
+    return ret;
+}
+#endif
+
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief start a multidrop message: drive the bus and send an address byte(9th bit set).
+ *        send the data with the write functions afterwards, then release the bus with
+ *        EUSART_ASYNCH_Multidrop_ReleaseBus. EUSART_ASYNCH_WriteBufferNonBlocking releases it
+ *        itself from the TX interrupt as soon as the last stop bit is out.
+ * @param address the address of the destination node.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means multidrop is not configured or a buffer is still being sent.
+ */
+Std_ReturnType EUSART_ASYNCH_Multidrop_WriteAddress(uint8 address)
+{
+    Std_ReturnType ret = E_OK;
+    uint16 l_pending = 0;
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+    ret = EUSART_ASYNCH_TX_Pending(&l_pending);
+#endif
+    if((0 == eusart_address_detect) || (0 != l_pending))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /*A filler byte of the last buffer may still be shifting out with the driver off*/
+        while(!TXSTAbits.TRMT);//blocking
+        if(eusart_de_pin_used)
+        {
+            ret = gpio_pin_write_logic(&eusart_de_pin , GPIO_HIGH);
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        /*TX9D is latched when TXREG moves to the shift register, so keep it set until then*/
+        TXSTAbits.TX9D = 1;
+        TXREG = address;
+        NOP();/*TXIF is valid from the second instruction cycle after the load*/
+        while(!PIR1bits.TXIF);//blocking
+        TXSTAbits.TX9D = 0;
+    }
+    return ret;
+}
+
+/**
+ * @brief wait for the last stop bit to leave the shift register and release the bus.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means multidrop is not configured.
+ */
+Std_ReturnType EUSART_ASYNCH_Multidrop_ReleaseBus(void)
+{
+    Std_ReturnType ret = E_OK;
+    if(0 == eusart_address_detect)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+        if(0 != eusart_de_release_pending)
+        {
+            EUSART_TX_InterruptDisable();
+            eusart_de_release_pending = 0;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+        EUSART_Multidrop_DriverDisable();
+    }
+    return ret;
+}
+
+/**
+ * @brief go back to address detection once the message for this node is handled,
+ *        the following data bytes for other nodes no longer interrupt the CPU.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means multidrop is not configured.
+ */
+Std_ReturnType EUSART_ASYNCH_Multidrop_Rearm(void)
+{
+    Std_ReturnType ret = E_OK;
+    if(0 == eusart_address_detect)
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        EUSART_ADDRESS_DETECT_MODE_ENABLE();
+    }
+    return ret;
+}
+
+/**
+ * @brief get the address that selected this node(node or broadcast address).
+ * @param address pointer to store the address.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means the node is not selected(waiting for its address).
+ */
+Std_ReturnType EUSART_ASYNCH_Multidrop_GetAddress(uint8 *address)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == address) || (0 == eusart_address_detect) || (1 == RCSTAbits.ADDEN))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *address = eusart_selected_address;
+    }
+    return ret;
+}
+#endif
+
+/**
+ * @brief calculate and initialize baud rate in the two registers...
+ *        TXSTA(SYNC bit & BRGH bit) and BAUDCON(BRG16 bit).
+ *        only integer math is used, BAUDRATE_ASYNCH_PRECOMPUTED costs no division at all.
+ * @param eusart pointer points to usart_t data.
+ */
+static void EUSART_Baud_Rate_Calc(const usart_t *eusart)
+{
+    uint32 Baud_Rate_Temp = 0;
+    switch(eusart -> baudrate_gen_cfg)
+    {
+        case BAUDRATE_ASYNCH_8BIT_LOW_SPEED:
+            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+            TXSTAbits.BRGH = EUSART_ASYNCH_LOW_SPEED;
+            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_8BIT_LOW_SPEED , eusart -> baudrate) - 1;
+            break;
+        case BAUDRATE_ASYNCH_8BIT_HIGH_SPEED:
+            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+            TXSTAbits.BRGH = EUSART_ASYNCH_HIGH_SPEED;
+            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_8BIT_HIGH_SPEED , eusart -> baudrate) - 1;
+            break;
+        case BAUDRATE_ASYNCH_16BIT_LOW_SPEED:
+            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+            TXSTAbits.BRGH = EUSART_ASYNCH_LOW_SPEED;
+            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_16BIT_LOW_SPEED , eusart -> baudrate) - 1;
+            break;
+        case BAUDRATE_ASYNCH_16BIT_HIGH_SPEED:
+            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+            TXSTAbits.BRGH = EUSART_ASYNCH_HIGH_SPEED;
+            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_16BIT_HIGH_SPEED , eusart -> baudrate) - 1;
+            break;  
+        case BAUDRATE_SYNCH_8BIT:
+            TXSTAbits.SYNC = EUSART_SYNCH_MODE;
+            BAUDCONbits.BRG16 = EUSART_8BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_SYNCH , eusart -> baudrate) - 1;
+            break; 
+        case BAUDRATE_SYNCH_16BIT:
+            TXSTAbits.SYNC = EUSART_SYNCH_MODE;
+            BAUDCONbits.BRG16 = EUSART_16BIT_BAUDRATE_GEN;
+            Baud_Rate_Temp = EUSART_BRG_DIVIDER(EUSART_BRG_DIV_SYNCH , eusart -> baudrate) - 1;
+            break;   
+#if EUSART_CFG_PRECOMPUTED_BAUDRATE == EUSART_CFG_FEATURE_ENABLE
+        case BAUDRATE_ASYNCH_PRECOMPUTED:
+            TXSTAbits.SYNC = EUSART_ASYNCH_MODE;
+            TXSTAbits.BRGH = EUSART_PRECOMPUTED_BRGH;
+            BAUDCONbits.BRG16 = EUSART_PRECOMPUTED_BRG16;
+            Baud_Rate_Temp = EUSART_PRECOMPUTED_SPBRG;
+            break;
+#endif
+        default:
+            /*NOTHING*/
+            break;
+    }
+    SPBRG = (uint8)(Baud_Rate_Temp);
+    SPBRGH = (uint8)(Baud_Rate_Temp >> 8);
+}
+
+/**
+ * @brief find the asynchronous generator setting with the lowest error.
+ * @param baudrate the requested baud rate.
+ * @param setting_index pointer to store the index in eusart_brg_settings.
+ * @param brg_value pointer to store the SPBRGH:SPBRG value.
+ * @return the error in hundredths of a percent(EUSART_BRG_ERROR_INVALID if impossible).
+ */
+static uint32 EUSART_Baudrate_Select(uint32 baudrate , uint8 *setting_index , uint16 *brg_value)
+{
+    uint32 l_best_error = EUSART_BRG_ERROR_INVALID;
+    uint32 l_error = 0;
+    uint32 l_divider = 0;
+    uint32 l_generated = 0;
+    uint8 l_counter = 0;
+    for(l_counter = 0 ; l_counter < (sizeof(eusart_brg_settings) / sizeof(eusart_brg_setting_t)) ; l_counter++)
+    {
+        l_divider = EUSART_BRG_DIVIDER((uint32)eusart_brg_settings[l_counter].divisor , baudrate);
+        if((0 == l_divider) || 
+           ((EUSART_8BIT_BAUDRATE_GEN == eusart_brg_settings[l_counter].brg16) && (l_divider > 256UL)) ||
+           (l_divider > 65536UL))
+        {
+            /*n does not fit the generator*/
+        }
+        else
+        {
+            l_generated = eusart_brg_settings[l_counter].divisor * baudrate * l_divider;
+            l_error = (_XTAL_FREQ > l_generated) ? (_XTAL_FREQ - l_generated) : (l_generated - _XTAL_FREQ);
+            l_error = l_error / ((l_generated / 10000UL) + 1);
+            if(l_error < l_best_error)
+            {
+                l_best_error = l_error;
+                *setting_index = l_counter;
+                *brg_value = (uint16)(l_divider - 1);
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+        }
+    }
+    return l_best_error;
+}
+
+/**
+ * @brief initialize TX with the desired values.
+ * @param eusart pointer points to usart_t data.
+ */
+static void EUSART_ASYNCH_TX_Init(const usart_t *eusart)
+{
+    if(EUSART_ASYNCH_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_enable)
+    {
+        TXSTAbits.TXEN = EUSART_ASYNCH_TX_ENABLE;
+        /*EUSART transmitter interrupt configuration*/
+        if(EUSART_ASYNCH_INTERRUPT_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_interrupt_enable)
+        {
+            PIE1bits.TXIE = EUSART_ASYNCH_INTERRUPT_TX_ENABLE;
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            EUSART_TX_InterruptEnable();
+            EUSART_TxInterruptHandler = eusart -> EUSART_TxInterruptHandler;
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == eusart -> usart_tx_cfg.usart_tx_priority)
+            {
+                INTERRUPT_GlobalInterruptHighEnable();
+                EUSART_TX_HighPrioritySet();
+            }
+            else if(INTERRUPT_LOW_PRIORITY == eusart -> usart_tx_cfg.usart_tx_priority)
+            {
+                INTERRUPT_GlobalInterruptLowEnable();
+                EUSART_TX_LowPrioritySet();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#else
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+        }
+        else if(EUSART_ASYNCH_INTERRUPT_TX_DISABLE == eusart -> usart_tx_cfg.usart_tx_interrupt_enable)
+        {
+            PIE1bits.TXIE = EUSART_ASYNCH_INTERRUPT_TX_DISABLE;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        /*EUSART 9-bit transmitter configuration*/
+        if(EUSART_ASYNCH_9BIT_TX_ENABLE == eusart -> usart_tx_cfg.usart_tx_9bit_enable)
+        {
+            TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_ENABLE;
+        }
+        else if(EUSART_ASYNCH_9BIT_TX_DISABLE == eusart -> usart_tx_cfg.usart_tx_9bit_enable)
+        {
+            TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_DISABLE;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+/**
+ * @brief initialize RX with the desired values.
+ * @param eusart
+ */
+static void EUSART_ASYNCH_RX_Init(const usart_t *eusart)
+{
+    if(EUSART_ASYNCH_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_enable)
+    {
+        RCSTAbits.CREN = EUSART_ASYNCH_RX_ENABLE;
+        /*EUSART receiver interrupt configuration*/
+        if(EUSART_ASYNCH_INTERRUPT_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_interrupt_enable)
+        {
+            PIE1bits.RCIE = EUSART_ASYNCH_INTERRUPT_RX_ENABLE;
+#if EUSART_RX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+            EUSART_RX_InterruptEnable();
+            EUSART_RxInterruptHandler = eusart -> EUSART_RxInterruptHandler;
+            EUSART_FramingErrorHandler = eusart -> EUSART_FramingErrorHandler;
+            EUSART_OverrunErrorHandler = eusart -> EUSART_OverrunErrorHandler;
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+            eusart_rx_head = 0;
+            eusart_rx_tail = 0;
+            eusart_rx_buffered = 1;
+            EUSART_RxByteHandler = eusart -> EUSART_RxByteHandler;
+#endif
+#if INTERRUPT_PRIORITY_LEVELS_ENABLE == INTERRUPT_FEATURE_ENABLE
+            INTERRUPT_PriorityLevelEnable();
+            if(INTERRUPT_HIGH_PRIORITY == eusart -> usart_rx_cfg.usart_rx_priority)
+            {
+                INTERRUPT_GlobalInterruptHighEnable();
+                EUSART_RX_HighPrioritySet();
+            }
+            else if(INTERRUPT_LOW_PRIORITY == eusart -> usart_rx_cfg.usart_rx_priority)
+            {
+                INTERRUPT_GlobalInterruptLowEnable();
+                EUSART_RX_LowPrioritySet();
+            }
+            else
+            {
+                /*NOTHING*/
+            }
+#else
+            INTERRUPT_GlobalInterruptEnable();
+            INTERRUPT_PeripheralInterruptEnable();
+#endif
+#endif
+        }
+        else if(EUSART_ASYNCH_INTERRUPT_RX_DISABLE == eusart -> usart_rx_cfg.usart_rx_interrupt_enable)
+        {
+            PIE1bits.RCIE = EUSART_ASYNCH_INTERRUPT_RX_DISABLE;
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+            eusart_rx_buffered = 0;
+#endif
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        /*EUSART 9-bit receiver configuration*/
+        if(EUSART_ASYNCH_9BIT_RX_ENABLE == eusart -> usart_rx_cfg.usart_rx_9bit_enable)
+        {
+            RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_ENABLE;
+        }
+        else if(EUSART_ASYNCH_9BIT_RX_DISABLE == eusart -> usart_rx_cfg.usart_rx_9bit_enable)
+        {
+            RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_DISABLE;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+void EUSART_TX_ISR()
+{
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+    if(0 != eusart_de_release_pending)
+    {
+        /*The filler moved to the shift register, so the last stop bit is out*/
+        EUSART_TX_InterruptDisable();
+        eusart_de_release_pending = 0;
+        gpio_pin_write_logic(&eusart_de_pin , GPIO_LOW);
+    }
+    else if(eusart_tx_index < eusart_tx_length)
+#else
+    if(eusart_tx_index < eusart_tx_length)
+#endif
+    {
+        TXREG = eusart_tx_buffer[eusart_tx_index];
+        eusart_tx_index++;
+    }
+    else
+    {
+        EUSART_TX_InterruptDisable();
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+        if((0 != eusart_tx_length) && (eusart_de_pin_used))
+        {
+            /*End of a buffer, the last byte is in the shift register. TXREG takes a filler that
+              moves to the shift register(TXIF) right after that stop bit, DE is dropped there
+              and the filler leaves with the driver off*/
+            eusart_tx_length = 0;
+            eusart_tx_index = 0;
+            eusart_de_release_pending = 1;
+            TXREG = 0xFF;
+            EUSART_TX_InterruptEnable();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+#endif
+        if(EUSART_TxInterruptHandler)
+        {
+           EUSART_TxInterruptHandler();
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+    }
+}
+
+void EUSART_RX_ISR()
+{
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+    if((EUSART_AUTOBAUD_IN_PROGRESS == eusart_autobaud_state) && (0 == BAUDCONbits.ABDEN))
+    {
+        EUSART_AutoBaud_Complete();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#endif
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    usart_error_status_t l_errors = EUSART_RX_Buffer_Fill();
+#endif
+    if(EUSART_RxInterruptHandler)
+    {
+       EUSART_RxInterruptHandler();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    if((EUSART_FRAMING_ERROR_DETECTED == l_errors.usart_ferr) && (EUSART_FramingErrorHandler))
+#else
+    if(EUSART_FramingErrorHandler)
+#endif
+    {
+       EUSART_FramingErrorHandler();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+    if((EUSART_OVERRUN_ERROR_DETECTED == l_errors.usart_oerr) && (EUSART_OverrunErrorHandler))
+#else
+    if(EUSART_OverrunErrorHandler)
+#endif
+    {
+       EUSART_OverrunErrorHandler();
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief drain the receive FIFO into the ring buffer, account for errors
+ *        and restart the receiver after an overrun.
+ * @return the errors detected while draining the FIFO.
+ */
+static usart_error_status_t EUSART_RX_Buffer_Fill(void)
+{
+    usart_error_status_t l_errors = {.status = 0};
+    uint8 l_rx_data = 0;
+    uint8 l_next_head = 0;
+    while(PIR1bits.RCIF)
+    {
+        /*FERR belongs to the byte on top of the FIFO, check it before reading RCREG*/
+        if(EUSART_FRAMING_ERROR_DETECTED == RCSTAbits.FERR)
+        {
+            l_rx_data = RCREG;
+            l_errors.usart_ferr = EUSART_FRAMING_ERROR_DETECTED;
+            eusart_rx_statistics.framing_errors++;
+        }
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+        else if((eusart_address_detect) && (1 == RCSTAbits.RX9D))
+        {
+            /*RX9D also belongs to the byte on top of the FIFO*/
+            l_rx_data = RCREG;
+            EUSART_Multidrop_Address(l_rx_data);
+        }
+#endif
+        else if(EUSART_RxByteHandler)
+        {
+            /*Stream consumers(e.g. frame decoders) take the byte directly*/
+            l_rx_data = RCREG;
+            EUSART_RxByteHandler(l_rx_data);
+        }
+        else
+        {
+            l_rx_data = RCREG;
+            l_next_head = (eusart_rx_head + 1) & EUSART_RX_BUFFER_MASK;
+            if(l_next_head == eusart_rx_tail)
+            {
+                eusart_rx_statistics.buffer_overflows++;
+            }
+            else
+            {
+                eusart_rx_buffer[eusart_rx_head] = l_rx_data;
+                eusart_rx_head = l_next_head;
+            }
+        }
+    }
+    /*The FIFO is drained, so restarting the receiver loses nothing already received*/
+    if(EUSART_OVERRUN_ERROR_DETECTED == RCSTAbits.OERR)
+    {
+        l_errors.usart_oerr = EUSART_OVERRUN_ERROR_DETECTED;
+        eusart_rx_statistics.overrun_errors++;
+        EUSART_ASYNCH_RX_Restart();
+    }
+    return l_errors;
+}
+#endif
+
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief finish an auto-baud measurement: discard the sync character and
+ *        restart the detection if the counter rolled over(ABDOVF).
+ */
+static void EUSART_AutoBaud_Complete(void)
+{
+    (void)RCREG;    /*Dummy read: clears RCIF, the sync character isn't a data byte*/
+    if(EUSART_AUTOBAUD_OVERFLOW_DETECTED == BAUDCONbits.ABDOVF)
+    {
+        BAUDCONbits.ABDOVF = EUSART_AUTOBAUD_OVERFLOW_CLEARED;
+        if(eusart_autobaud_overflows < 0xFF)
+        {
+            eusart_autobaud_overflows++;
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        EUSART_AUTOBAUD_ENABLE();
+    }
+    else
+    {
+        eusart_autobaud_state = EUSART_AUTOBAUD_DONE;
+    }
+}
+#endif
+
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+/**
+ * @brief configure 9-bit address detection and the transceiver driver enable pin.
+ * @param eusart pointer points to usart_t data.
+ */
+static void EUSART_Multidrop_Init(const usart_t *eusart)
+{
+    eusart_address_detect = eusart -> multidrop_cfg.address_detect_enable;
+    eusart_node_address = eusart -> multidrop_cfg.node_address;
+    eusart_de_pin_used = eusart -> multidrop_cfg.de_pin_enable;
+    if(eusart_de_pin_used)
+    {
+        eusart_de_pin = eusart -> multidrop_cfg.de_pin;
+        eusart_de_pin.direction = GPIO_DIRECTION_OUTPUT;
+        eusart_de_pin.logic = GPIO_LOW;/*Receive until this node transmits*/
+        gpio_pin_intialize(&eusart_de_pin);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(EUSART_ADDRESS_DETECT_ENABLE == eusart_address_detect)
+    {
+        /*Address bytes are marked by the 9th bit*/
+        TXSTAbits.TX9 = EUSART_ASYNCH_9BIT_TX_ENABLE;
+        TXSTAbits.TX9D = 0;
+        RCSTAbits.RX9 = EUSART_ASYNCH_9BIT_RX_ENABLE;
+        EUSART_ADDRESS_DETECT_MODE_ENABLE();
+    }
+    else
+    {
+        EUSART_ADDRESS_DETECT_MODE_DISABLE();
+    }
+}
+
+/**
+ * @brief handle an address byte: accept the data phase for this node,
+ *        otherwise(re)arm ADDEN so the hardware drops the foreign data bytes.
+ * @param address the received address byte.
+ */
+static void EUSART_Multidrop_Address(uint8 address)
+{
+    if((eusart_node_address == address) || (EUSART_CFG_BROADCAST_ADDRESS == address))
+    {
+        eusart_selected_address = address;
+        EUSART_ADDRESS_DETECT_MODE_DISABLE();
+    }
+    else
+    {
+        EUSART_ADDRESS_DETECT_MODE_ENABLE();
+    }
+}
+
+/**
+ * @brief release the bus once the stop bit of the last byte is out(TRMT),
+ *        waits up to one character time(main context only).
+ */
+static void EUSART_Multidrop_DriverDisable(void)
+{
+    if(eusart_de_pin_used)
+    {
+        while(!TXSTAbits.TRMT);//at most one character time
+        gpio_pin_write_logic(&eusart_de_pin , GPIO_LOW);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+#endif
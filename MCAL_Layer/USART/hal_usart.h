@@ -1,110 +1,277 @@
-/* 
- * File:   hal_usart.h
- * Author: Yousab Gamal
- * Created on April 5, 2025, 2:24 PM
- */
-
-#ifndef HAL_USART_H
-#define	HAL_USART_H
-
-/******************Section: Includes**********************/
-#include <xc.h>
-#include "hal_usart_cfg.h"
-#include "../mcal_std_types.h"
-#include "../../MCAL_Layer/GPIO/hal_gpio.h"
-#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
-
-/******************Section: Macros Declarations***********/
-#define EUSART_SYNCH_MODE              1
-#define EUSART_ASYNCH_MODE             0
-
-#define EUSART_ASYNCH_HIGH_SPEED       1
-#define EUSART_ASYNCH_LOW_SPEED        0
-
-#define EUSART_16BIT_BAUDRATE_GEN      1
-#define EUSART_8BIT_BAUDRATE_GEN       0
-
-#define EUSART_ASYNCH_TX_ENABLE             1
-#define EUSART_ASYNCH_TX_DISABLE            0
-#define EUSART_ASYNCH_9BIT_TX_ENABLE        1
-#define EUSART_ASYNCH_9BIT_TX_DISABLE       0
-#define EUSART_ASYNCH_INTERRUPT_TX_ENABLE   1
-#define EUSART_ASYNCH_INTERRUPT_TX_DISABLE  0
-
-#define EUSART_ASYNCH_RX_ENABLE             1
-#define EUSART_ASYNCH_RX_DISABLE            0
-#define EUSART_ASYNCH_9BIT_RX_ENABLE        1
-#define EUSART_ASYNCH_9BIT_RX_DISABLE       0
-#define EUSART_ASYNCH_INTERRUPT_RX_ENABLE   1
-#define EUSART_ASYNCH_INTERRUPT_RX_DISABLE  0
-
-#define EUSART_FRAMING_ERROR_DETECTED       1
-#define EUSART_FRAMING_ERROR_CLEARED        0
-
-#define EUSART_OVERRUN_ERROR_DETECTED       1
-#define EUSART_OVERRUN_ERROR_CLEARED        0
-
-/******************Section: Macros Functions Declarations*/
-#define EUSART_MODULE_ENABLE()       (RCSTAbits.SPEN = 1)
-#define EUSART_MODULE_DISABLE()      (RCSTAbits.SPEN = 0)
-
-/******************Section: Data Types Declarations*******/
-typedef enum{
-    BAUDRATE_ASYNCH_8BIT_LOW_SPEED,
-    BAUDRATE_ASYNCH_8BIT_HIGH_SPEED,
-    BAUDRATE_ASYNCH_16BIT_LOW_SPEED,
-    BAUDRATE_ASYNCH_16BIT_HIGH_SPEED,
-    BAUDRATE_SYNCH_8BIT,
-    BAUDRATE_SYNCH_16BIT,
-}baudrate_gen_t;
-
-typedef struct{
-    uint8 usart_tx_reserved         : 5;
-    uint8 usart_tx_enable           : 1;
-    uint8 usart_tx_9bit_enable      : 1;
-    uint8 usart_tx_interrupt_enable : 1;
-    interrupt_priority_cfg usart_tx_priority;
-}usart_tx_cfg_t;
-
-typedef struct{
-    uint8 usart_rx_reserved         : 5;
-    uint8 usart_rx_enable           : 1;
-    uint8 usart_rx_9bit_enable      : 1;
-    uint8 usart_rx_interrupt_enable : 1;
-    interrupt_priority_cfg usart_rx_priority;
-}usart_rx_cfg_t;
-
-typedef union{
-    struct{
-        uint8 usart_rx_reserved : 6;
-        uint8 usart_ferr        : 1;
-        uint8 usart_oerr        : 1;
-    };
-    uint8 status;
-}usart_error_status_t;
-
-typedef struct{
-    uint32 baudrate;
-    baudrate_gen_t baudrate_gen_cfg;
-    usart_tx_cfg_t usart_tx_cfg;
-    usart_rx_cfg_t usart_rx_cfg;
-    usart_error_status_t error_status;
-    void(*EUSART_TxInterruptHandler)(void);
-    void(*EUSART_RxInterruptHandler)(void);
-    void(*EUSART_FramingErrorHandler)(void);
-    void(*EUSART_OverrunErrorHandler)(void);
-}usart_t;
-
-/******************Section: Functions Declarations********/
-Std_ReturnType EUSART_ASYNCH_Init(const usart_t *eusart);
-Std_ReturnType EUSART_ASYNCH_DeInit(const usart_t *eusart);
-void EUSART_ASYNCH_ReadByteBlocking(uint8 *data);
-void EUSART_ASYNCH_ReadByteNonBlocking(uint8 *data);
-void EUSART_ASYNCH_RX_Restart(void);
-void EUSART_ASYNCH_WriteByteBlocking(uint8 data);
-void EUSART_ASYNCH_WriteByteNonBlocking(uint8 data);
-Std_ReturnType EUSART_ASYNCH_WriteStringNonBlocking(uint8 *data , uint16 string_length);
-Std_ReturnType EUSART_ASYNCH_WriteStringBlocking(uint8 *data , uint16 string_length);
-
-#endif	/* HAL_USART_H */
-
+/* 
+ * File:   hal_usart.h
+ * Author: Yousab Gamal
+ * Created on April 5, 2025, 2:24 PM
+ */
+
+#ifndef HAL_USART_H
+#define	HAL_USART_H
+
+/******************Section: Includes**********************/
+#include <xc.h>
+#include "hal_usart_cfg.h"
+#include "../mcal_std_types.h"
+#include "../../MCAL_Layer/GPIO/hal_gpio.h"
+#include "../../MCAL_Layer/interrupt/mcal_internal_interrupt.h"
+
+/******************Section: Macros Declarations***********/
+#define EUSART_SYNCH_MODE              1
+#define EUSART_ASYNCH_MODE             0
+
+#define EUSART_ASYNCH_HIGH_SPEED       1
+#define EUSART_ASYNCH_LOW_SPEED        0
+
+#define EUSART_16BIT_BAUDRATE_GEN      1
+#define EUSART_8BIT_BAUDRATE_GEN       0
+
+#define EUSART_ASYNCH_TX_ENABLE             1
+#define EUSART_ASYNCH_TX_DISABLE            0
+#define EUSART_ASYNCH_9BIT_TX_ENABLE        1
+#define EUSART_ASYNCH_9BIT_TX_DISABLE       0
+#define EUSART_ASYNCH_INTERRUPT_TX_ENABLE   1
+#define EUSART_ASYNCH_INTERRUPT_TX_DISABLE  0
+
+#define EUSART_ASYNCH_RX_ENABLE             1
+#define EUSART_ASYNCH_RX_DISABLE            0
+#define EUSART_ASYNCH_9BIT_RX_ENABLE        1
+#define EUSART_ASYNCH_9BIT_RX_DISABLE       0
+#define EUSART_ASYNCH_INTERRUPT_RX_ENABLE   1
+#define EUSART_ASYNCH_INTERRUPT_RX_DISABLE  0
+
+#define EUSART_FRAMING_ERROR_DETECTED       1
+#define EUSART_FRAMING_ERROR_CLEARED        0
+
+#define EUSART_OVERRUN_ERROR_DETECTED       1
+#define EUSART_OVERRUN_ERROR_CLEARED        0
+
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+#if (EUSART_CFG_RX_BUFFER_SIZE < 2U) || (EUSART_CFG_RX_BUFFER_SIZE > 256U) || \
+    ((EUSART_CFG_RX_BUFFER_SIZE & (EUSART_CFG_RX_BUFFER_SIZE - 1U)) != 0U)
+#error "EUSART_CFG_RX_BUFFER_SIZE must be a power of two between 2 and 256"
+#endif
+#define EUSART_RX_BUFFER_MASK               ((uint8)(EUSART_CFG_RX_BUFFER_SIZE - 1U))
+#endif
+
+/*Baud rate generator clock divisors(Fosc / (divisor * (n + 1)))*/
+#define EUSART_BRG_DIV_8BIT_LOW_SPEED       64UL
+#define EUSART_BRG_DIV_8BIT_HIGH_SPEED      16UL
+#define EUSART_BRG_DIV_16BIT_LOW_SPEED      16UL
+#define EUSART_BRG_DIV_16BIT_HIGH_SPEED     4UL
+#define EUSART_BRG_DIV_SYNCH                4UL
+
+#define EUSART_BRG_ERROR_INVALID            0xFFFFFFUL
+
+#define EUSART_AUTOBAUD_SYNC_CHAR           0x55U
+#define EUSART_AUTOBAUD_OVERFLOW_DETECTED   1
+#define EUSART_AUTOBAUD_OVERFLOW_CLEARED    0
+
+#define EUSART_ADDRESS_DETECT_ENABLE        1
+#define EUSART_ADDRESS_DETECT_DISABLE       0
+#define EUSART_DE_PIN_ENABLE                1
+#define EUSART_DE_PIN_DISABLE               0
+
+#define EUSART_SYNCH_MASTER                 1
+#define EUSART_SYNCH_SLAVE                  0
+#define EUSART_SYNCH_CLOCK_IDLE_HIGH        1
+#define EUSART_SYNCH_CLOCK_IDLE_LOW         0
+#define EUSART_SYNCH_MSB_FIRST              1
+#define EUSART_SYNCH_LSB_FIRST              0     /*Native EUSART bit order*/
+
+#if (EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE) && \
+    (EUSART_CFG_RX_RING_BUFFER != EUSART_CFG_FEATURE_ENABLE)
+#error "EUSART_CFG_MULTIDROP needs EUSART_CFG_RX_RING_BUFFER, addresses are filtered in the RX ISR"
+#endif
+
+/******************Section: Macros Functions Declarations*/
+#define EUSART_MODULE_ENABLE()       (RCSTAbits.SPEN = 1)
+#define EUSART_MODULE_DISABLE()      (RCSTAbits.SPEN = 0)
+
+#define EUSART_AUTOBAUD_ENABLE()      (BAUDCONbits.ABDEN = 1)
+#define EUSART_AUTOBAUD_DISABLE()     (BAUDCONbits.ABDEN = 0)
+
+#define EUSART_ADDRESS_DETECT_MODE_ENABLE()    (RCSTAbits.ADDEN = 1)
+#define EUSART_ADDRESS_DETECT_MODE_DISABLE()   (RCSTAbits.ADDEN = 0)
+
+/*Rounded (n + 1) for a divisor and baud rate*/
+#define EUSART_BRG_DIVIDER(_DIV , _BAUD)    ((_XTAL_FREQ + (((_DIV) * (_BAUD)) / 2)) / ((_DIV) * (_BAUD)))
+/*Baud rate error in hundredths of a percent, EUSART_BRG_ERROR_INVALID if n does not fit*/
+#define EUSART_BRG_ERROR(_DIV , _BAUD , _NMAX)                                                  \
+    (((0 == EUSART_BRG_DIVIDER(_DIV , _BAUD)) || (EUSART_BRG_DIVIDER(_DIV , _BAUD) > ((_NMAX) + 1))) \
+     ? EUSART_BRG_ERROR_INVALID                                                                   \
+     : ((((_XTAL_FREQ) > ((_DIV) * (_BAUD) * EUSART_BRG_DIVIDER(_DIV , _BAUD)))                    \
+         ? ((_XTAL_FREQ) - ((_DIV) * (_BAUD) * EUSART_BRG_DIVIDER(_DIV , _BAUD)))                  \
+         : (((_DIV) * (_BAUD) * EUSART_BRG_DIVIDER(_DIV , _BAUD)) - (_XTAL_FREQ))) * 10000UL        \
+        / ((_DIV) * (_BAUD) * EUSART_BRG_DIVIDER(_DIV , _BAUD))))
+
+#if EUSART_CFG_PRECOMPUTED_BAUDRATE == EUSART_CFG_FEATURE_ENABLE
+#define EUSART_ERROR_8BIT_LOW_SPEED   EUSART_BRG_ERROR(EUSART_BRG_DIV_8BIT_LOW_SPEED , EUSART_CFG_BAUDRATE , 255UL)
+#define EUSART_ERROR_8BIT_HIGH_SPEED  EUSART_BRG_ERROR(EUSART_BRG_DIV_8BIT_HIGH_SPEED , EUSART_CFG_BAUDRATE , 255UL)
+#define EUSART_ERROR_16BIT_LOW_SPEED  EUSART_BRG_ERROR(EUSART_BRG_DIV_16BIT_LOW_SPEED , EUSART_CFG_BAUDRATE , 65535UL)
+#define EUSART_ERROR_16BIT_HIGH_SPEED EUSART_BRG_ERROR(EUSART_BRG_DIV_16BIT_HIGH_SPEED , EUSART_CFG_BAUDRATE , 65535UL)
+
+/*Pick the generator setting with the lowest error, prefer the finest resolution on ties*/
+#if (EUSART_ERROR_16BIT_HIGH_SPEED <= EUSART_ERROR_16BIT_LOW_SPEED) && \
+    (EUSART_ERROR_16BIT_HIGH_SPEED <= EUSART_ERROR_8BIT_HIGH_SPEED) && \
+    (EUSART_ERROR_16BIT_HIGH_SPEED <= EUSART_ERROR_8BIT_LOW_SPEED)
+#define EUSART_PRECOMPUTED_BRGH       EUSART_ASYNCH_HIGH_SPEED
+#define EUSART_PRECOMPUTED_BRG16      EUSART_16BIT_BAUDRATE_GEN
+#define EUSART_PRECOMPUTED_DIV        EUSART_BRG_DIV_16BIT_HIGH_SPEED
+#define EUSART_PRECOMPUTED_ERROR      EUSART_ERROR_16BIT_HIGH_SPEED
+#elif (EUSART_ERROR_16BIT_LOW_SPEED <= EUSART_ERROR_8BIT_HIGH_SPEED) && \
+      (EUSART_ERROR_16BIT_LOW_SPEED <= EUSART_ERROR_8BIT_LOW_SPEED)
+#define EUSART_PRECOMPUTED_BRGH       EUSART_ASYNCH_LOW_SPEED
+#define EUSART_PRECOMPUTED_BRG16      EUSART_16BIT_BAUDRATE_GEN
+#define EUSART_PRECOMPUTED_DIV        EUSART_BRG_DIV_16BIT_LOW_SPEED
+#define EUSART_PRECOMPUTED_ERROR      EUSART_ERROR_16BIT_LOW_SPEED
+#elif (EUSART_ERROR_8BIT_HIGH_SPEED <= EUSART_ERROR_8BIT_LOW_SPEED)
+#define EUSART_PRECOMPUTED_BRGH       EUSART_ASYNCH_HIGH_SPEED
+#define EUSART_PRECOMPUTED_BRG16      EUSART_8BIT_BAUDRATE_GEN
+#define EUSART_PRECOMPUTED_DIV        EUSART_BRG_DIV_8BIT_HIGH_SPEED
+#define EUSART_PRECOMPUTED_ERROR      EUSART_ERROR_8BIT_HIGH_SPEED
+#else
+#define EUSART_PRECOMPUTED_BRGH       EUSART_ASYNCH_LOW_SPEED
+#define EUSART_PRECOMPUTED_BRG16      EUSART_8BIT_BAUDRATE_GEN
+#define EUSART_PRECOMPUTED_DIV        EUSART_BRG_DIV_8BIT_LOW_SPEED
+#define EUSART_PRECOMPUTED_ERROR      EUSART_ERROR_8BIT_LOW_SPEED
+#endif
+
+#if EUSART_PRECOMPUTED_ERROR > EUSART_CFG_BAUDRATE_MAX_ERROR
+#error "EUSART_CFG_BAUDRATE can not be generated from _XTAL_FREQ within EUSART_CFG_BAUDRATE_MAX_ERROR"
+#endif
+
+#define EUSART_PRECOMPUTED_SPBRG      ((uint16)(EUSART_BRG_DIVIDER(EUSART_PRECOMPUTED_DIV , EUSART_CFG_BAUDRATE) - 1))
+#endif
+
+/******************Section: Data Types Declarations*******/
+typedef enum{
+    BAUDRATE_ASYNCH_8BIT_LOW_SPEED,
+    BAUDRATE_ASYNCH_8BIT_HIGH_SPEED,
+    BAUDRATE_ASYNCH_16BIT_LOW_SPEED,
+    BAUDRATE_ASYNCH_16BIT_HIGH_SPEED,
+    BAUDRATE_SYNCH_8BIT,
+    BAUDRATE_SYNCH_16BIT,
+    BAUDRATE_ASYNCH_PRECOMPUTED,     /*Settings from EUSART_CFG_BAUDRATE, baudrate is ignored*/
+}baudrate_gen_t;
+
+typedef struct{
+    uint8 usart_tx_reserved         : 5;
+    uint8 usart_tx_enable           : 1;
+    uint8 usart_tx_9bit_enable      : 1;
+    uint8 usart_tx_interrupt_enable : 1;
+    interrupt_priority_cfg usart_tx_priority;
+}usart_tx_cfg_t;
+
+typedef struct{
+    uint8 usart_rx_reserved         : 5;
+    uint8 usart_rx_enable           : 1;
+    uint8 usart_rx_9bit_enable      : 1;
+    uint8 usart_rx_interrupt_enable : 1;
+    interrupt_priority_cfg usart_rx_priority;
+}usart_rx_cfg_t;
+
+typedef struct{
+    uint8 usart_synch_reserved      : 6;
+    uint8 usart_clock_polarity      : 1;   /*EUSART_SYNCH_CLOCK_IDLE_HIGH / _LOW*/
+    uint8 usart_bit_order           : 1;   /*EUSART_SYNCH_MSB_FIRST / _LSB_FIRST*/
+}usart_synch_cfg_t;
+
+typedef union{
+    struct{
+        uint8 usart_rx_reserved : 6;
+        uint8 usart_ferr        : 1;
+        uint8 usart_oerr        : 1;
+    };
+    uint8 status;
+}usart_error_status_t;
+
+typedef struct{
+    uint16 framing_errors;   /*Bytes dropped because of a missing stop bit*/
+    uint16 overrun_errors;   /*Hardware FIFO overruns(OERR), receiver restarted*/
+    uint16 buffer_overflows; /*Bytes dropped because the ring buffer was full*/
+}usart_rx_statistics_t;
+
+typedef enum{
+    EUSART_AUTOBAUD_IDLE = 0,
+    EUSART_AUTOBAUD_IN_PROGRESS,   /*Waiting for the 0x55 sync character*/
+    EUSART_AUTOBAUD_DONE,          /*SPBRGH:SPBRG hold the measured value*/
+}usart_autobaud_state_t;
+
+typedef struct{
+    pin_config_t de_pin;                 /*Transceiver driver enable, high while transmitting*/
+    uint8 node_address;                  /*Address bytes(9th bit set) selecting this node*/
+    uint8 multidrop_reserved     : 6;
+    uint8 address_detect_enable  : 1;    /*Ignore data bytes until this node is addressed*/
+    uint8 de_pin_enable          : 1;    /*de_pin is wired to the transceiver*/
+}usart_multidrop_cfg_t;
+
+typedef struct{
+    uint32 baudrate;
+    baudrate_gen_t baudrate_gen_cfg;
+    usart_tx_cfg_t usart_tx_cfg;
+    usart_rx_cfg_t usart_rx_cfg;
+    usart_error_status_t error_status;
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+    usart_multidrop_cfg_t multidrop_cfg;
+#endif
+#if EUSART_CFG_SYNCH_MASTER == EUSART_CFG_FEATURE_ENABLE
+    usart_synch_cfg_t usart_synch_cfg;
+#endif
+    void(*EUSART_TxInterruptHandler)(void);
+    void(*EUSART_RxInterruptHandler)(void);
+    void(*EUSART_FramingErrorHandler)(void);
+    void(*EUSART_OverrunErrorHandler)(void);
+    void(*EUSART_RxByteHandler)(uint8 data);/*Optional, receives each byte from the RX ISR instead of the ring buffer*/
+}usart_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType EUSART_ASYNCH_Init(const usart_t *eusart);
+Std_ReturnType EUSART_ASYNCH_DeInit(const usart_t *eusart);
+void EUSART_ASYNCH_ReadByteBlocking(uint8 *data);
+void EUSART_ASYNCH_ReadByteNonBlocking(uint8 *data);
+void EUSART_ASYNCH_RX_Restart(void);
+void EUSART_ASYNCH_WriteByteBlocking(uint8 data);
+void EUSART_ASYNCH_WriteByteNonBlocking(uint8 data);
+void EUSART_ASYNCH_FormatSink(void *context , uint8 data);
+Std_ReturnType EUSART_ASYNCH_WriteStringNonBlocking(uint8 *data , uint16 string_length);
+Std_ReturnType EUSART_ASYNCH_WriteStringBlocking(uint8 *data , uint16 string_length);
+
+#if EUSART_TX_INTERRUPT_FEATURE_ENABLE == INTERRUPT_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNCH_WriteBufferNonBlocking(const uint8 *data , uint16 length);
+Std_ReturnType EUSART_ASYNCH_TX_Pending(uint16 *pending);
+#endif
+
+#if EUSART_CFG_RX_RING_BUFFER == EUSART_CFG_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNCH_RX_Available(uint16 *available);
+Std_ReturnType EUSART_ASYNCH_RX_Read(uint8 *data , uint16 length , uint16 *read_count);
+Std_ReturnType EUSART_ASYNCH_RX_Peek(uint8 *data);
+Std_ReturnType EUSART_ASYNCH_RX_Flush(void);
+Std_ReturnType EUSART_ASYNCH_RX_GetStatistics(usart_rx_statistics_t *statistics);
+Std_ReturnType EUSART_ASYNCH_RX_ClearStatistics(void);
+#endif
+
+Std_ReturnType EUSART_ASYNCH_SetBaudrate(uint32 baudrate);
+Std_ReturnType EUSART_ASYNCH_GetBaudrate(uint32 *baudrate);
+Std_ReturnType EUSART_ASYNCH_GetFastestBaudrate(uint32 peer_max_baudrate , uint32 *baudrate);
+
+#if EUSART_CFG_AUTOBAUD == EUSART_CFG_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNCH_AutoBaud_Start(void);
+Std_ReturnType EUSART_ASYNCH_AutoBaud_Stop(void);
+Std_ReturnType EUSART_ASYNCH_AutoBaud_GetState(usart_autobaud_state_t *state);
+Std_ReturnType EUSART_ASYNCH_AutoBaud_GetOverflowCount(uint8 *overflow_count);
+#endif
+
+#if EUSART_CFG_MULTIDROP == EUSART_CFG_FEATURE_ENABLE
+Std_ReturnType EUSART_ASYNCH_Multidrop_WriteAddress(uint8 address);
+Std_ReturnType EUSART_ASYNCH_Multidrop_ReleaseBus(void);
+Std_ReturnType EUSART_ASYNCH_Multidrop_Rearm(void);
+Std_ReturnType EUSART_ASYNCH_Multidrop_GetAddress(uint8 *address);
+#endif
+
+#if EUSART_CFG_SYNCH_MASTER == EUSART_CFG_FEATURE_ENABLE
+Std_ReturnType EUSART_SYNCH_Master_Init(const usart_t *eusart);
+Std_ReturnType EUSART_SYNCH_Master_WriteBuffer(const uint8 *data , uint16 length);
+Std_ReturnType EUSART_SYNCH_Master_ReadBuffer(uint8 *data , uint16 length);
+#endif
+
+#endif	/* HAL_USART_H */
+
@@ -1,21 +1,45 @@
-/* 
- * File:   hal_usart_cfg.h
- * Author: Yousab Gamal
- * Created on April 5, 2025, 2:30 PM
- */
-
-#ifndef HAL_USART_CFG_H
-#define	HAL_USART_CFG_H
-
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* HAL_USART_CFG_H */
-
+/* 
+ * File:   hal_usart_cfg.h
+ * Author: Yousab Gamal
+ * Created on April 5, 2025, 2:30 PM
+ */
+
+#ifndef HAL_USART_CFG_H
+#define	HAL_USART_CFG_H
+
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define EUSART_CFG_FEATURE_ENABLE          1
+#define EUSART_CFG_FEATURE_DISABLE         0
+
+/*Receive ring buffer filled from the RX interrupt*/
+#define EUSART_CFG_RX_RING_BUFFER          EUSART_CFG_FEATURE_ENABLE
+/*Ring buffer size in bytes(must be a power of two, max 256)*/
+#define EUSART_CFG_RX_BUFFER_SIZE          64U
+
+/*Baud rate generator settings computed at compile time(BAUDRATE_ASYNCH_PRECOMPUTED)*/
+#define EUSART_CFG_PRECOMPUTED_BAUDRATE    EUSART_CFG_FEATURE_ENABLE
+/*Requested baud rate for the precomputed settings*/
+#define EUSART_CFG_BAUDRATE                9600UL
+/*Maximum accepted baud rate error in hundredths of a percent(200 = 2.00%)*/
+#define EUSART_CFG_BAUDRATE_MAX_ERROR      200UL
+
+/*Automatic baud rate detection on a received 0x55 sync character*/
+#define EUSART_CFG_AUTOBAUD                EUSART_CFG_FEATURE_ENABLE
+
+/*RS-485 multidrop: 9-bit address detection(ADDEN) and transceiver driver enable pin*/
+#define EUSART_CFG_MULTIDROP               EUSART_CFG_FEATURE_ENABLE
+/*Address accepted by every node*/
+#define EUSART_CFG_BROADCAST_ADDRESS       0x00U
+
+/*Synchronous master mode(clock on RC6/CK, data on RC7/DT) for shift register chains*/
+#define EUSART_CFG_SYNCH_MASTER            EUSART_CFG_FEATURE_ENABLE
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* HAL_USART_CFG_H */
@@ -1,23 +1,23 @@
-/* 
- * File:   compiler.h
- * Author: Ibrahim Shenouda
- *
- * Created on November 22, 2024, 3:54 PM
- */
-
-#ifndef COMPILER_H
-#define	COMPILER_H
-
-/******************Section: Includes**********************/
-#include <xc.h>
-
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* COMPILER_H */
-
+/* 
+ * File:   compiler.h
+ * Author: Ibrahim Shenouda
+ *
+ * Created on November 22, 2024, 3:54 PM
+ */
+
+#ifndef COMPILER_H
+#define	COMPILER_H
+
+/******************Section: Includes**********************/
+#include <xc.h>
+
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* COMPILER_H */
+
@@ -1,23 +1,23 @@
-/* 
- * File:   device_config.h
- * Author: Ibrahim Shenouda
- *
- * Created on November 22, 2024, 4:24 PM
- */
-
-#ifndef DEVICE_CONFIG_H
-#define	DEVICE_CONFIG_H
-/******************Section: Includes**********************/
-
-/******************Section: Macros Declarations***********/
-#define _XTAL_FREQ 4000000UL
-//#define _XTAL_FREQ 8000000UL
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-#endif	/* DEVICE_CONFIG_H */
-
+/* 
+ * File:   device_config.h
+ * Author: Ibrahim Shenouda
+ *
+ * Created on November 22, 2024, 4:24 PM
+ */
+
+#ifndef DEVICE_CONFIG_H
+#define	DEVICE_CONFIG_H
+/******************Section: Includes**********************/
+
+/******************Section: Macros Declarations***********/
+#define _XTAL_FREQ 4000000UL
+//#define _XTAL_FREQ 8000000UL
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+#endif	/* DEVICE_CONFIG_H */
+
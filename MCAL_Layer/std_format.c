@@ -0,0 +1,481 @@
+/* 
+ * File:   std_format.c
+ */
+
+#include "std_format.h"
+
+/*
+ * Conversion: %[-][0][width][.precision][l]specifier
+ *   d/i : signed int(sint32 with l)
+ *   u   : unsigned int(uint32 with l)
+ *   x/X : hexadecimal
+ *   c   : character
+ *   s   : string
+ *   %   : literal '%'
+ * On d/u the precision prints fixed-point: the value is taken in units of
+ * 10^-precision, e.g. std_format(sink , ctx , "%.2d" , -1234) -> "-12.34".
+ * int is 16-bit on XC8, so 32-bit values need the l modifier.
+ */
+
+typedef struct{
+    uint8 width;
+    uint8 precision;
+    uint8 left_align : 1;
+    uint8 zero_pad : 1;
+    uint8 long_arg : 1;
+    uint8 upper_case : 1;
+    uint8 negative : 1;
+}std_format_spec_t;
+
+/*Digits are produced by subtraction, the PIC18 has no divide instruction*/
+static const uint32 std_format_powers_of_ten[STD_FORMAT_MAX_DIGITS] = {
+    1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL,
+    10000UL, 1000UL, 100UL, 10UL, 1UL
+};
+
+static const uint8 std_format_hex_digits[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+static void std_format_pad(std_format_sink_t sink , void *context , uint8 character , uint8 count);
+static void std_format_decimal(std_format_sink_t sink , void *context , uint32 value , 
+                               const std_format_spec_t *spec);
+static void std_format_hex(std_format_sink_t sink , void *context , uint32 value , 
+                           const std_format_spec_t *spec);
+static void std_format_string(std_format_sink_t sink , void *context , const char *str , 
+                              const std_format_spec_t *spec);
+
+/**
+ * @brief format and stream the output to sink, see std_vformat.
+ * @param sink the output callback.
+ * @param context passed unchanged to sink.
+ * @param format the format string.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType std_format(std_format_sink_t sink , void *context , const char *format , ...)
+{
+    Std_ReturnType ret = E_OK;
+    va_list args;
+    va_start(args , format);
+    ret = std_vformat(sink , context , format , args);
+    va_end(args);
+    return ret;
+}
+
+/**
+ * @brief format and stream the output to sink, no intermediate buffer is used.
+ * @param sink the output callback.
+ * @param context passed unchanged to sink.
+ * @param format the format string.
+ * @param args the arguments.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function(unknown specifiers are printed as is).
+ */
+Std_ReturnType std_vformat(std_format_sink_t sink , void *context , const char *format , va_list args)
+{
+    Std_ReturnType ret = E_OK;
+    std_format_spec_t l_spec;
+    sint32 l_signed = 0;
+    uint32 l_value = 0;
+    const char *l_str = NULL;
+    if((NULL == sink) || (NULL == format))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        while('\0' != *format)
+        {
+            if('%' != *format)
+            {
+                sink(context , (uint8)*format);
+                format++;
+            }
+            else
+            {
+                format++;
+                l_spec.width = 0;
+                l_spec.precision = 0;
+                l_spec.left_align = 0;
+                l_spec.zero_pad = 0;
+                l_spec.long_arg = 0;
+                l_spec.upper_case = 0;
+                l_spec.negative = 0;
+                while(('-' == *format) || ('0' == *format))
+                {
+                    if('-' == *format)
+                    {
+                        l_spec.left_align = 1;
+                    }
+                    else
+                    {
+                        l_spec.zero_pad = 1;
+                    }
+                    format++;
+                }
+                while((*format >= '0') && (*format <= '9'))
+                {
+                    l_spec.width = (uint8)((l_spec.width * 10) + (uint8)(*format - '0'));
+                    format++;
+                }
+                if('.' == *format)
+                {
+                    format++;
+                    while((*format >= '0') && (*format <= '9'))
+                    {
+                        l_spec.precision = (uint8)((l_spec.precision * 10) + (uint8)(*format - '0'));
+                        format++;
+                    }
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                if('l' == *format)
+                {
+                    l_spec.long_arg = 1;
+                    format++;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                if(l_spec.width > STD_FORMAT_MAX_WIDTH)
+                {
+                    l_spec.width = STD_FORMAT_MAX_WIDTH;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                if(l_spec.precision >= STD_FORMAT_MAX_DIGITS)
+                {
+                    l_spec.precision = STD_FORMAT_MAX_DIGITS - 1;
+                }
+                else
+                {
+                    /*NOTHING*/
+                }
+                switch(*format)
+                {
+                    case 'd':
+                    case 'i':
+                        /*va_arg needs the promoted types, not the fixed width typedefs*/
+                        if(l_spec.long_arg)
+                        {
+                            l_signed = va_arg(args , long);
+                        }
+                        else
+                        {
+                            l_signed = va_arg(args , int);
+                        }
+                        if(l_signed < 0)
+                        {
+                            l_spec.negative = 1;
+                            l_value = (uint32)0 - (uint32)l_signed;
+                        }
+                        else
+                        {
+                            l_value = (uint32)l_signed;
+                        }
+                        std_format_decimal(sink , context , l_value , &l_spec);
+                        break;
+                    case 'u':
+                        if(l_spec.long_arg)
+                        {
+                            l_value = va_arg(args , unsigned long);
+                        }
+                        else
+                        {
+                            l_value = va_arg(args , unsigned int);
+                        }
+                        std_format_decimal(sink , context , l_value , &l_spec);
+                        break;
+                    case 'X':
+                        l_spec.upper_case = 1;
+                        /*fall through*/
+                    case 'x':
+                        if(l_spec.long_arg)
+                        {
+                            l_value = va_arg(args , unsigned long);
+                        }
+                        else
+                        {
+                            l_value = va_arg(args , unsigned int);
+                        }
+                        std_format_hex(sink , context , l_value , &l_spec);
+                        break;
+                    case 'c':
+                        if(!l_spec.left_align)
+                        {
+                            std_format_pad(sink , context , ' ' , l_spec.width - 1);
+                        }
+                        else
+                        {
+                            /*NOTHING*/
+                        }
+                        sink(context , (uint8)va_arg(args , int));
+                        if(l_spec.left_align)
+                        {
+                            std_format_pad(sink , context , ' ' , l_spec.width - 1);
+                        }
+                        else
+                        {
+                            /*NOTHING*/
+                        }
+                        break;
+                    case 's':
+                        l_str = va_arg(args , const char *);
+                        std_format_string(sink , context , l_str , &l_spec);
+                        break;
+                    case '%':
+                        sink(context , '%');
+                        break;
+                    default:
+                        ret = E_NOT_OK;
+                        sink(context , '%');
+                        if('\0' != *format)
+                        {
+                            sink(context , (uint8)*format);
+                        }
+                        else
+                        {
+                            /*Keep format on the terminator*/
+                            format--;
+                        }
+                        break;
+                }
+                format++;
+            }
+        }
+    }
+    return ret;
+}
+
+/**
+ * @brief prepare a RAM buffer to be used as the context of std_format_buffer_sink.
+ * @param buffer pointer points to std_format_buffer_t data.
+ * @param data the destination, must hold at least one byte for the terminator.
+ * @param size the size of data in bytes.
+ * @return...
+ *           E_OK: means function done without any errors.
+ *           E_NOT_OK: means there is an error during run the function.
+ */
+Std_ReturnType std_format_buffer_init(std_format_buffer_t *buffer , uint8 *data , uint8 size)
+{
+    Std_ReturnType ret = E_OK;
+    if((NULL == buffer) || (NULL == data) || (0 == size))
+    {
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        buffer -> data = data;
+        buffer -> size = size;
+        buffer -> length = 0;
+        data[0] = '\0';
+    }
+    return ret;
+}
+
+/**
+ * @brief sink writing to a std_format_buffer_t, extra characters are dropped.
+ * @param context pointer points to std_format_buffer_t data.
+ * @param character the character to append.
+ */
+void std_format_buffer_sink(void *context , uint8 character)
+{
+    std_format_buffer_t *l_buffer = (std_format_buffer_t *)context;
+    if((NULL != l_buffer) && ((l_buffer -> length + 1) < l_buffer -> size))
+    {
+        l_buffer -> data[l_buffer -> length] = character;
+        l_buffer -> length++;
+        l_buffer -> data[l_buffer -> length] = '\0';
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void std_format_pad(std_format_sink_t sink , void *context , uint8 character , uint8 count)
+{
+    /*count wraps to a large value when the field is wider than width, so check the sign bit*/
+    if(count < 0x80U)
+    {
+        while(count > 0)
+        {
+            sink(context , character);
+            count--;
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void std_format_decimal(std_format_sink_t sink , void *context , uint32 value , 
+                               const std_format_spec_t *spec)
+{
+    uint8 l_digits = 1;
+    uint8 l_length = 0;
+    uint8 l_index = 0;
+    uint8 l_digit = 0;
+    while((l_digits < STD_FORMAT_MAX_DIGITS) && 
+          (value >= std_format_powers_of_ten[STD_FORMAT_MAX_DIGITS - 1 - l_digits]))
+    {
+        l_digits++;
+    }
+    if(l_digits <= spec -> precision)
+    {
+        l_digits = spec -> precision + 1;/*Leading "0." for fractions*/
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    l_length = l_digits + spec -> negative + ((0 != spec -> precision) ? 1 : 0);
+    if((!spec -> left_align) && (!spec -> zero_pad))
+    {
+        std_format_pad(sink , context , ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(spec -> negative)
+    {
+        sink(context , '-');
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if((!spec -> left_align) && (spec -> zero_pad))
+    {
+        std_format_pad(sink , context , '0' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    for(l_index = STD_FORMAT_MAX_DIGITS - l_digits ; l_index < STD_FORMAT_MAX_DIGITS ; l_index++)
+    {
+        l_digit = '0';
+        while(value >= std_format_powers_of_ten[l_index])
+        {
+            value -= std_format_powers_of_ten[l_index];
+            l_digit++;
+        }
+        if((0 != spec -> precision) && (l_index == (STD_FORMAT_MAX_DIGITS - spec -> precision)))
+        {
+            sink(context , '.');
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        sink(context , l_digit);
+    }
+    if(spec -> left_align)
+    {
+        std_format_pad(sink , context , ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void std_format_hex(std_format_sink_t sink , void *context , uint32 value , 
+                           const std_format_spec_t *spec)
+{
+    uint8 l_digits = 1;
+    uint8 l_length = 0;
+    uint8 l_digit = 0;
+    while((l_digits < 8) && (0 != (value >> (l_digits * 4))))
+    {
+        l_digits++;
+    }
+    l_length = l_digits;
+    if(!spec -> left_align)
+    {
+        std_format_pad(sink , context , (spec -> zero_pad) ? '0' : ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    while(l_digits > 0)
+    {
+        l_digits--;
+        l_digit = std_format_hex_digits[(uint8)(value >> (l_digits * 4)) & 0x0F];
+        if((!spec -> upper_case) && (l_digit > '9'))
+        {
+            l_digit += ('a' - 'A');
+        }
+        else
+        {
+            /*NOTHING*/
+        }
+        sink(context , l_digit);
+    }
+    if(spec -> left_align)
+    {
+        std_format_pad(sink , context , ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
+
+static void std_format_string(std_format_sink_t sink , void *context , const char *str , 
+                              const std_format_spec_t *spec)
+{
+    uint8 l_length = 0;
+    if(NULL == str)
+    {
+        str = "(null)";
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(spec -> width > 0)
+    {
+        while((l_length < spec -> width) && ('\0' != str[l_length]))
+        {
+            l_length++;
+        }
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    if(!spec -> left_align)
+    {
+        std_format_pad(sink , context , ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+    while('\0' != *str)
+    {
+        sink(context , (uint8)*str);
+        str++;
+    }
+    if(spec -> left_align)
+    {
+        std_format_pad(sink , context , ' ' , spec -> width - l_length);
+    }
+    else
+    {
+        /*NOTHING*/
+    }
+}
@@ -0,0 +1,35 @@
+/* 
+ * File:   std_format.h
+ */
+
+#ifndef STD_FORMAT_H
+#define	STD_FORMAT_H
+
+/******************Section: Includes**********************/
+#include <stdarg.h>
+#include "mcal_std_types.h"
+
+/******************Section: Macros Declarations***********/
+#define STD_FORMAT_MAX_DIGITS            10U   /*Decimal digits of the largest uint32*/
+#define STD_FORMAT_MAX_WIDTH             32U
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+/*Receives the formatted output one character at a time*/
+typedef void (*std_format_sink_t)(void *context , uint8 character);
+
+/*Context of std_format_buffer_sink, output is always '\0' terminated and truncated to size-1*/
+typedef struct{
+    uint8 *data;
+    uint8 size;
+    uint8 length;
+}std_format_buffer_t;
+
+/******************Section: Functions Declarations********/
+Std_ReturnType std_format(std_format_sink_t sink , void *context , const char *format , ...);
+Std_ReturnType std_vformat(std_format_sink_t sink , void *context , const char *format , va_list args);
+Std_ReturnType std_format_buffer_init(std_format_buffer_t *buffer , uint8 *data , uint8 size);
+void std_format_buffer_sink(void *context , uint8 character);
+
+#endif	/* STD_FORMAT_H */
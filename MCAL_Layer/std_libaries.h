@@ -1,24 +1,23 @@
-/* 
- * File:   std_libaries.h
- * Author: Ibrahim Shenouda
- *
- * Created on November 22, 2024, 3:53 PM
- */
-
-#ifndef STD_LIBARIES_H
-#define	STD_LIBARIES_H
-
-/******************Section: Includes**********************/
-#include <stdio.h>
-#include <stdlib.h>
-/******************Section: Macros Declarations***********/
-
-/******************Section: Macros Functions Declarations*/
-
-/******************Section: Data Types Declarations*******/
-
-/******************Section: Functions Declarations********/
-
-
-#endif	/* STD_LIBARIES_H */
-
+/* 
+ * File:   std_libaries.h
+ * Author: Ibrahim Shenouda
+ *
+ * Created on November 22, 2024, 3:53 PM
+ */
+
+#ifndef STD_LIBARIES_H
+#define	STD_LIBARIES_H
+
+/******************Section: Includes**********************/
+#include <stddef.h>
+/******************Section: Macros Declarations***********/
+
+/******************Section: Macros Functions Declarations*/
+
+/******************Section: Data Types Declarations*******/
+
+/******************Section: Functions Declarations********/
+
+
+#endif	/* STD_LIBARIES_H */
+